@@ -228,6 +228,20 @@ void DMA_Disable(DMA_TypeDef *DMAx, DMA_Stream stream)
     while (DMA_Stream->CR & (1 << 0));
 }
 
+/**
+ * @brief  DMA 스트림의 남은 전송 횟수(NDTR)를 가져옵니다.
+ * @param  DMAx: 확인할 DMA 컨트롤러 (DMA1 또는 DMA2)
+ * @param  stream: 확인할 DMA 스트림
+ * @return 남은 데이터 항목 수
+ */
+uint16_t DMA_GetCount(DMA_TypeDef *DMAx, DMA_Stream stream)
+{
+    // 스트림 레지스터 가져오기
+    DMA_Stream_TypeDef *DMA_Stream = DMA_GetStreamRegister(DMAx, stream);
+    
+    return (uint16_t)DMA_Stream->NDTR;
+}
+
 /**
  * @brief  DMA 전송 완료 플래그를 확인합니다.
  * @param  DMAx: 확인할 DMA 컨트롤러 (DMA1 또는 DMA2)
@@ -168,6 +168,14 @@ void DMA_Enable(DMA_TypeDef *DMAx, DMA_Stream stream);
  */
 void DMA_Disable(DMA_TypeDef *DMAx, DMA_Stream stream);
 
+/**
+ * @brief  DMA 스트림의 남은 전송 횟수(NDTR)를 가져옵니다.
+ * @param  DMAx: 확인할 DMA 컨트롤러 (DMA1 또는 DMA2)
+ * @param  stream: 확인할 DMA 스트림
+ * @return 남은 데이터 항목 수 (순환 모드에서는 현재 버퍼 위치 계산에 사용)
+ */
+uint16_t DMA_GetCount(DMA_TypeDef *DMAx, DMA_Stream stream);
+
 /**
  * @brief  DMA 전송 완료 플래그를 확인합니다.
  * @param  DMAx: 확인할 DMA 컨트롤러 (DMA1 또는 DMA2)
@@ -0,0 +1,113 @@
+#include "eeprom.h"
+#include <assert.h>
+
+/* 메모리 주소 중 장치 주소로 전달되는 상위 비트를 반영한 장치 주소 계산 내부 함수 */
+static uint8_t EEPROM_DevAddress(EEPROM_Device *dev, uint32_t addr)
+{
+    return (uint8_t)(dev->DevAddress | ((addr >> (8 * dev->MemAddSize)) & 0x07));
+}
+
+/* 메모리 주소 필드로 표현할 수 있는 블록 내 남은 바이트 수 계산 내부 함수 */
+static uint32_t EEPROM_BlockRemaining(EEPROM_Device *dev, uint32_t addr)
+{
+    uint32_t block_size = 1UL << (8 * dev->MemAddSize);
+
+    return block_size - (addr & (block_size - 1));
+}
+
+/* 쓰기 사이클 완료 대기 */
+I2C_Status EEPROM_WaitReady(EEPROM_Device *dev)
+{
+    /* 널 포인터 체크 */
+    assert(dev != NULL);
+
+    return I2C_IsDeviceReady(dev->Instance, dev->DevAddress, dev->PollTrials);
+}
+
+/* EEPROM 읽기 */
+I2C_Status EEPROM_Read(EEPROM_Device *dev, uint32_t addr, uint8_t *data, uint32_t len)
+{
+    /* 널 포인터 체크 */
+    assert(dev != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    I2C_Status status;
+    uint32_t chunk;
+
+    if (addr + len > dev->Capacity)
+    {
+        return I2C_ERROR;
+    }
+
+    while (len > 0)
+    {
+        /* 블록 경계와 I2C_MemRead 최대 길이로 제한 */
+        chunk = EEPROM_BlockRemaining(dev, addr);
+        if (chunk > len)
+        {
+            chunk = len;
+        }
+        if (chunk > 0xFFFF)
+        {
+            chunk = 0xFFFF;
+        }
+
+        status = I2C_MemRead(dev->Instance, EEPROM_DevAddress(dev, addr), (uint16_t)addr, dev->MemAddSize, data, (uint16_t)chunk);
+        if (status != I2C_OK)
+            return status;
+
+        addr += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+
+    return I2C_OK;
+}
+
+/* EEPROM 쓰기 */
+I2C_Status EEPROM_Write(EEPROM_Device *dev, uint32_t addr, const uint8_t *data, uint32_t len)
+{
+    /* 널 포인터 체크 */
+    assert(dev != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+    /* 페이지 크기 체크 */
+    assert(dev->PageSize > 0);
+
+    I2C_Status status;
+    uint32_t chunk;
+
+    if (addr + len > dev->Capacity)
+    {
+        return I2C_ERROR;
+    }
+
+    while (len > 0)
+    {
+        /* 페이지 경계를 넘으면 같은 페이지의 앞부분을 덮어쓰므로 경계에서 나눔 */
+        chunk = dev->PageSize - (addr % dev->PageSize);
+        if (chunk > len)
+        {
+            chunk = len;
+        }
+
+        status = I2C_MemWrite(dev->Instance, EEPROM_DevAddress(dev, addr), (uint16_t)addr, dev->MemAddSize,
+                              (uint8_t *)data, (uint16_t)chunk);
+        if (status != I2C_OK)
+            return status;
+
+        /* 쓰기 사이클 동안 장치는 주소에 NACK - ACK가 돌아오는 즉시 다음 페이지 진행 */
+        status = EEPROM_WaitReady(dev);
+        if (status != I2C_OK)
+            return status;
+
+        addr += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+
+    return I2C_OK;
+}
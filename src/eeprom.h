@@ -0,0 +1,51 @@
+#ifndef __EEPROM_H
+#define __EEPROM_H
+
+#include "i2c.h"
+
+/**
+ * @brief 24Cxx 시리얼 EEPROM 장치 정보 구조체
+ */
+typedef struct
+{
+    I2C_TypeDef *Instance;     /*!< EEPROM이 연결된 I2C 주변장치 */
+    uint8_t DevAddress;        /*!< 장치의 7비트 기본 주소 (A2-A0 반영, 일반적으로 0x50) */
+    I2C_MemAddSize MemAddSize; /*!< 메모리 주소 크기 (24C01-24C16: 8비트, 24C32 이상: 16비트) */
+    uint16_t PageSize;         /*!< 페이지 크기 (바이트, 예: 24C02=8, 24C32=32, 24C256=64) */
+    uint32_t Capacity;         /*!< 전체 용량 (바이트) */
+    uint32_t PollTrials;       /*!< 쓰기 사이클 완료를 기다리는 최대 ACK 폴링 횟수 */
+} EEPROM_Device;
+
+/**
+ * @brief  EEPROM에서 데이터를 읽습니다.
+ * @param  dev: EEPROM 장치 정보 구조체 포인터
+ * @param  addr: 시작 메모리 주소
+ * @param  data: 읽은 데이터를 저장할 버퍼의 포인터
+ * @param  len: 읽을 데이터의 길이 (바이트)
+ * @return I2C_Status: 읽기 결과 (범위를 벗어나면 I2C_ERROR)
+ * @note   순차 읽기는 페이지 경계와 무관하며, 주소 상위 비트가 장치 주소에 포함되는
+ *         블록 경계(24C04/08/16 등)에서만 트랜잭션을 나눕니다.
+ */
+I2C_Status EEPROM_Read(EEPROM_Device *dev, uint32_t addr, uint8_t *data, uint32_t len);
+
+/**
+ * @brief  EEPROM에 데이터를 씁니다.
+ * @param  dev: EEPROM 장치 정보 구조체 포인터
+ * @param  addr: 시작 메모리 주소
+ * @param  data: 쓸 데이터 버퍼의 포인터
+ * @param  len: 쓸 데이터의 길이 (바이트)
+ * @return I2C_Status: 쓰기 결과 (범위를 벗어나면 I2C_ERROR, 쓰기 사이클이 끝나지 않으면 I2C_BUSY)
+ * @note   페이지 경계에서 자동으로 나누어 쓰고, 각 페이지 후 ACK 폴링으로 쓰기 사이클 완료를
+ *         감지하여 최악 시간(5ms)을 기다리지 않고 바로 다음 페이지를 씁니다.
+ *         함수가 I2C_OK를 반환하면 마지막 페이지까지 기록이 완료된 상태입니다.
+ */
+I2C_Status EEPROM_Write(EEPROM_Device *dev, uint32_t addr, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief  진행 중인 쓰기 사이클이 끝날 때까지 ACK 폴링으로 대기합니다.
+ * @param  dev: EEPROM 장치 정보 구조체 포인터
+ * @return I2C_Status: I2C_OK(준비됨) 또는 I2C_BUSY(PollTrials 초과)
+ */
+I2C_Status EEPROM_WaitReady(EEPROM_Device *dev);
+
+#endif /* __EEPROM_H */
@@ -1,6 +1,89 @@
 #include "i2c.h"
+#include "rcc.h"
 #include <assert.h>
 
+/* SR1 플래그 비트 마스크 */
+#define I2C_SR1_BTF  (1U << 2)
+#define I2C_SR1_RXNE (1U << 6)
+#define I2C_SR1_TXE  (1U << 7)
+
+/* 버스 복구 시 SCL 반주기 (us, 100KHz 기준) */
+#define I2C_RECOVERY_HALF_PERIOD_US 5
+
+/* 고착 판단 시 SCL High/SDA Low 상태 확인 횟수 (반주기 간격, 약 500us) */
+#define I2C_STUCK_SAMPLE_COUNT 100
+
+/* 주소 스캔 시 ADDR/AF 대기 타임아웃 (주소 1바이트 전송 시간에 여유를 둔 값) */
+#define I2C_SCAN_TIMEOUT 2000
+
+/* 중재 손실 재시도 기본 정책 */
+#define I2C_RETRY_DEFAULT_COUNT      3
+#define I2C_RETRY_DEFAULT_MIN_US     20
+#define I2C_RETRY_DEFAULT_MAX_US     500
+
+/* I2C DMA 요청 매핑 (DMA1, RM0383 DMA1 request mapping) */
+typedef struct
+{
+    DMA_Stream TxStream;  /* 송신 스트림 */
+    DMA_Stream RxStream;  /* 수신 스트림 */
+    DMA_Channel Channel;  /* 요청 채널 */
+} I2C_DMAMap;
+
+/* I2C DMA 전송 상태 */
+typedef struct
+{
+    I2C_DMACallback Callback; /* 전송 완료 콜백 */
+    uint8_t Receive;          /* 0: 송신, 1: 수신 */
+    uint8_t StopIssued;       /* 정지 조건이 이미 요청되었는지 여부 */
+    uint8_t WaitBTF;          /* 송신 DMA 완료 후 마지막 바이트(BTF) 대기 중 여부 */
+    volatile uint8_t Busy;    /* DMA 전송 진행 중 여부 */
+} I2C_DMAContext;
+
+static const I2C_DMAMap i2c_dma_map[] = {
+    {DMA_STREAM_6, DMA_STREAM_0, DMA_CHANNEL_1}, /* I2C1 */
+    {DMA_STREAM_7, DMA_STREAM_2, DMA_CHANNEL_7}  /* I2C2 */
+};
+
+static I2C_DMAContext i2c_dma_ctx[2];
+
+/* 버스 복구용 GPIO 핀 정보 */
+typedef struct
+{
+    GPIO_TypeDef *Port;        /* SCL/SDA 포트 (NULL: 복구 비활성화) */
+    uint8_t SclPin;            /* SCL 핀 번호 */
+    uint8_t SdaPin;            /* SDA 핀 번호 */
+    GPIO_AlternateFunction AF; /* I2C 대체 기능 번호 */
+    uint8_t AutoRecovery;      /* I2C_Start()에서 고착 감지 시 자동 복구 여부 */
+} I2C_RecoveryPins;
+
+static I2C_RecoveryPins i2c_recovery_pins[2];
+
+/* 버스 복구 후 재초기화를 위해 저장한 설정 */
+static I2C_Config i2c_saved_config[2];
+
+/* 중재 손실 재시도 정책, 통계, 백오프 난수 상태 */
+static I2C_RetryPolicy i2c_retry_policy[2] = {
+    {I2C_RETRY_DEFAULT_COUNT, I2C_RETRY_DEFAULT_MIN_US, I2C_RETRY_DEFAULT_MAX_US}, /* I2C1 */
+    {I2C_RETRY_DEFAULT_COUNT, I2C_RETRY_DEFAULT_MIN_US, I2C_RETRY_DEFAULT_MAX_US}  /* I2C2 */
+};
+static I2C_Stats i2c_stats[2];
+static uint32_t i2c_backoff_seed[2];
+
+/* I2C 인스턴스 인덱스 반환 내부 함수 */
+static uint8_t I2C_GetIndex(I2C_TypeDef *I2Cx)
+{
+    return (I2Cx == I2C1) ? 0 : 1;
+}
+
+/* 중재 손실 처리 내부 함수 - 인터페이스는 자동으로 슬레이브 모드가 되므로 정지 조건을 생성하지 않음 */
+static I2C_Status I2C_ArbitrationLost(I2C_TypeDef *I2Cx)
+{
+    I2Cx->SR1.b.ARLO = 0;
+    i2c_stats[I2C_GetIndex(I2Cx)].ArbitrationLost++;
+
+    return I2C_ARBITRATION_LOST;
+}
+
 /* I2C 클럭 설정 내부 함수 */
 static void I2C_ClockConfig(I2C_TypeDef *I2Cx, I2C_Config *config, uint32_t pclk1)
 {
@@ -67,6 +150,13 @@ void I2C_Init(I2C_TypeDef *I2Cx, I2C_Config *config)
         RCC->APB1ENR.b.I2C2EN = 1;
     }
 
+    /* 버스 복구 시 재초기화를 위해 설정 저장 */
+    i2c_saved_config[I2C_GetIndex(I2Cx)] = *config;
+
+    /* 백오프 난수 시드 - 자신의 주소를 섞어 마스터마다 다른 백오프가 나오도록 함 */
+    i2c_backoff_seed[I2C_GetIndex(I2Cx)] = 0x9E3779B9UL ^ ((uint32_t)config->OwnAddress << 24) ^
+                                           ((uint32_t)config->OwnAddress2 << 16) ^ config->ClockSpeed;
+
     /* I2C 비활성화 */
     I2Cx->CR1.b.PE = 0;
 
@@ -76,6 +166,16 @@ void I2C_Init(I2C_TypeDef *I2Cx, I2C_Config *config)
     /* 자신의 주소 설정 */
     I2Cx->OAR1 = (config->OwnAddress << 1);
 
+    /* 두 번째 주소 설정 (ENDUAL) */
+    if (config->OwnAddress2)
+    {
+        I2Cx->OAR2 = (config->OwnAddress2 << 1) | 0x01;
+    }
+    else
+    {
+        I2Cx->OAR2 = 0;
+    }
+
     /* General Call 및 Clock Stretching 설정 */
     if (config->GeneralCall)
     {
@@ -86,6 +186,11 @@ void I2C_Init(I2C_TypeDef *I2Cx, I2C_Config *config)
         I2Cx->CR1.b.NOSTRETCH = 1;
     }
 
+    /* SMBus 호스트 모드 및 하드웨어 PEC 설정 */
+    I2Cx->CR1.b.SMBUS = config->SMBusMode ? 1 : 0;
+    I2Cx->CR1.b.SMBTYPE = config->SMBusMode ? 1 : 0;
+    I2Cx->CR1.b.ENPEC = config->PECEnable ? 1 : 0;
+
     /* I2C 활성화 */
     I2Cx->CR1.b.PE = 1;
 }
@@ -108,6 +213,135 @@ void I2C_DeInit(I2C_TypeDef *I2Cx)
     }
 }
 
+/* 마이크로초 단위 지연 내부 함수 (버스 복구, 중재 손실 백오프) */
+static void I2C_DelayUs(uint32_t us)
+{
+    volatile uint32_t count = (RCC_GetHCLK() / 1000000) * us / 4;
+
+    while (count--)
+        ;
+}
+
+/* 버스 고착 감지 내부 함수 - 래치된 버스 에러, 또는 SCL이 High인 채로 SDA가 계속 Low이면 고착 */
+static uint8_t I2C_IsBusStuck(I2C_TypeDef *I2Cx)
+{
+    I2C_RecoveryPins *pins = &i2c_recovery_pins[I2C_GetIndex(I2Cx)];
+    uint16_t scl = (uint16_t)(1U << pins->SclPin);
+    uint16_t sda = (uint16_t)(1U << pins->SdaPin);
+
+    /* 잘못된 위치의 시작/정지 조건으로 래치된 버스 에러 */
+    if (I2Cx->SR1.b.BERR)
+    {
+        I2Cx->SR1.b.BERR = 0;
+        return 1;
+    }
+
+    if (pins->Port == NULL)
+    {
+        return 0;
+    }
+
+    /* 다른 마스터의 전송은 SCL을 토글하고, 클럭 스트레칭은 SCL을 Low로 유지하므로 고착이 아님 */
+    for (uint8_t i = 0; i < I2C_STUCK_SAMPLE_COUNT; i++)
+    {
+        if (!GPIO_ReadPin(pins->Port, scl) || GPIO_ReadPin(pins->Port, sda))
+        {
+            return 0;
+        }
+        I2C_DelayUs(I2C_RECOVERY_HALF_PERIOD_US);
+    }
+
+    return 1;
+}
+
+/* 버스 복구용 핀 등록 */
+void I2C_SetRecoveryPins(I2C_TypeDef *I2Cx, GPIO_TypeDef *GPIOx, uint8_t sclPin, uint8_t sdaPin, GPIO_AlternateFunction af)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+
+    I2C_RecoveryPins *pins = &i2c_recovery_pins[I2C_GetIndex(I2Cx)];
+
+    pins->Port = GPIOx;
+    pins->SclPin = sclPin;
+    pins->SdaPin = sdaPin;
+    pins->AF = af;
+}
+
+/* 시작 조건 생성 시 자동 버스 복구 설정 */
+void I2C_SetAutoRecovery(I2C_TypeDef *I2Cx, uint8_t enable)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+
+    i2c_recovery_pins[I2C_GetIndex(I2Cx)].AutoRecovery = enable ? 1 : 0;
+}
+
+/* I2C 버스 복구 */
+I2C_Status I2C_RecoverBus(I2C_TypeDef *I2Cx)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+
+    uint8_t idx = I2C_GetIndex(I2Cx);
+    I2C_RecoveryPins *pins = &i2c_recovery_pins[idx];
+    uint16_t scl = (uint16_t)(1U << pins->SclPin);
+    uint16_t sda = (uint16_t)(1U << pins->SdaPin);
+    GPIO_Config gpio_config = {
+        .Mode = GPIO_MODE_OUTPUT,
+        .Otype = GPIO_OTYPE_OPENDRAIN,
+        .Speed = GPIO_SPEED_HIGH,
+        .PuPd = GPIO_PUPD_PULLUP,
+        .AF = pins->AF
+    };
+
+    if (pins->Port == NULL)
+    {
+        return I2C_ERROR;
+    }
+
+    /* I2C 비활성화 후 SCL/SDA를 오픈 드레인 출력(High)으로 전환 */
+    I2Cx->CR1.b.PE = 0;
+    GPIO_WritePin(pins->Port, scl | sda, 1);
+    gpio_config.Pin = pins->SclPin;
+    GPIO_Init(pins->Port, &gpio_config);
+    gpio_config.Pin = pins->SdaPin;
+    GPIO_Init(pins->Port, &gpio_config);
+
+    /* SDA가 해제될 때까지 최대 9개의 SCL 펄스 - 슬레이브가 남은 비트를 모두 내보내도록 함 */
+    for (uint8_t i = 0; i < 9 && !GPIO_ReadPin(pins->Port, sda); i++)
+    {
+        GPIO_WritePin(pins->Port, scl, 0);
+        I2C_DelayUs(I2C_RECOVERY_HALF_PERIOD_US);
+        GPIO_WritePin(pins->Port, scl, 1);
+        I2C_DelayUs(I2C_RECOVERY_HALF_PERIOD_US);
+    }
+
+    /* 정지 조건 생성: SCL High 구간에서 SDA Low → High */
+    GPIO_WritePin(pins->Port, scl, 0);
+    I2C_DelayUs(I2C_RECOVERY_HALF_PERIOD_US);
+    GPIO_WritePin(pins->Port, sda, 0);
+    I2C_DelayUs(I2C_RECOVERY_HALF_PERIOD_US);
+    GPIO_WritePin(pins->Port, scl, 1);
+    I2C_DelayUs(I2C_RECOVERY_HALF_PERIOD_US);
+    GPIO_WritePin(pins->Port, sda, 1);
+    I2C_DelayUs(I2C_RECOVERY_HALF_PERIOD_US);
+
+    /* 핀을 I2C 대체 기능으로 복원 */
+    gpio_config.Mode = GPIO_MODE_ALT;
+    gpio_config.Pin = pins->SclPin;
+    GPIO_Init(pins->Port, &gpio_config);
+    gpio_config.Pin = pins->SdaPin;
+    GPIO_Init(pins->Port, &gpio_config);
+
+    /* 소프트웨어 리셋으로 BUSY 등 내부 상태를 초기화한 뒤 저장된 설정으로 재초기화 */
+    I2Cx->CR1.b.SWRST = 1;
+    I2Cx->CR1.b.SWRST = 0;
+    I2C_Init(I2Cx, &i2c_saved_config[idx]);
+
+    return I2Cx->SR2.b.BUSY ? I2C_BUSY : I2C_OK;
+}
+
 /* I2C 시작 조건 생성 */
 I2C_Status I2C_Start(I2C_TypeDef *I2Cx)
 {
@@ -115,6 +349,38 @@ I2C_Status I2C_Start(I2C_TypeDef *I2Cx)
     assert(I2Cx != NULL);
 
     uint32_t timeout = I2C_TIMEOUT_DEFAULT;
+    I2C_Status status;
+
+    I2C_RecoveryPins *pins = &i2c_recovery_pins[I2C_GetIndex(I2Cx)];
+
+    /* 반복 시작 조건이 아니면 버스가 해제될 때까지 대기 */
+    if (!I2Cx->SR2.b.MSL)
+    {
+        /* 이전 전송에서 래치된 중재 손실은 버리지 않고 보고 */
+        if (I2Cx->SR1.b.ARLO)
+        {
+            return I2C_ArbitrationLost(I2Cx);
+        }
+
+        while (I2Cx->SR2.b.BUSY)
+        {
+            if (--timeout == 0)
+            {
+                /* 다른 마스터가 버스를 사용 중이면 BUSY, 실제 고착이고 자동 복구가 켜진 경우에만 복구 */
+                if (pins->Port == NULL || !pins->AutoRecovery || !I2C_IsBusStuck(I2Cx))
+                {
+                    return I2C_BUSY;
+                }
+                status = I2C_RecoverBus(I2Cx);
+                if (status != I2C_OK)
+                {
+                    return status;
+                }
+                break;
+            }
+        }
+        timeout = I2C_TIMEOUT_DEFAULT;
+    }
 
     /* 시작 조건 생성 */
     I2Cx->CR1.b.START = 1;
@@ -122,6 +388,11 @@ I2C_Status I2C_Start(I2C_TypeDef *I2Cx)
     /* 시작 조건 생성 완료 대기 */
     while (!I2Cx->SR1.b.SB)
     {
+        /* 다른 마스터에게 중재 손실 */
+        if (I2Cx->SR1.b.ARLO)
+        {
+            return I2C_ArbitrationLost(I2Cx);
+        }
         if (--timeout == 0)
         {
             return I2C_TIMEOUT;
@@ -207,8 +478,169 @@ I2C_Status I2C_ReadByte(I2C_TypeDef *I2Cx, uint8_t *data, uint8_t ack)
     return I2C_OK;
 }
 
-/* 여러 바이트 데이터 쓰기 */
-I2C_Status I2C_WriteData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len)
+/* 슬레이브 주소 전송 내부 함수 (ADDR 플래그 클리어는 호출자가 수행) */
+static I2C_Status I2C_SendAddressTimeout(I2C_TypeDef *I2Cx, uint8_t addrByte, uint32_t timeout)
+{
+    /* 슬레이브 주소 전송 */
+    I2Cx->DR = addrByte;
+
+    /* ADDR 플래그 대기 */
+    while (!I2Cx->SR1.b.ADDR)
+    {
+        /* 다른 마스터에게 중재 손실 */
+        if (I2Cx->SR1.b.ARLO)
+        {
+            return I2C_ArbitrationLost(I2Cx);
+        }
+        /* 슬레이브 응답 없음 (NACK) */
+        if (I2Cx->SR1.b.AF)
+        {
+            I2Cx->SR1.b.AF = 0;
+            I2C_Stop(I2Cx);
+            return I2C_ERROR;
+        }
+        if (--timeout == 0)
+        {
+            return I2C_TIMEOUT;
+        }
+    }
+
+    return I2C_OK;
+}
+
+/* 기본 타임아웃으로 슬레이브 주소 전송 내부 함수 */
+static I2C_Status I2C_SendAddress(I2C_TypeDef *I2Cx, uint8_t addrByte)
+{
+    return I2C_SendAddressTimeout(I2Cx, addrByte, I2C_TIMEOUT_DEFAULT);
+}
+
+/* SR1 플래그 대기 내부 함수 (대기 중 응답 실패 감지) */
+static I2C_Status I2C_WaitFlag(I2C_TypeDef *I2Cx, uint32_t flag)
+{
+    uint32_t timeout = I2C_TIMEOUT_DEFAULT;
+
+    while (!(I2Cx->SR1.w & flag))
+    {
+        /* 다른 마스터에게 중재 손실 */
+        if (I2Cx->SR1.b.ARLO)
+        {
+            return I2C_ArbitrationLost(I2Cx);
+        }
+        /* 슬레이브 응답 없음 (NACK) */
+        if (I2Cx->SR1.b.AF)
+        {
+            I2Cx->SR1.b.AF = 0;
+            I2C_Stop(I2Cx);
+            return I2C_ERROR;
+        }
+        if (--timeout == 0)
+        {
+            return I2C_TIMEOUT;
+        }
+    }
+
+    return I2C_OK;
+}
+
+/* 여러 바이트 송신 내부 함수 (주소 단계 이후) */
+static I2C_Status I2C_TransmitBytes(I2C_TypeDef *I2Cx, uint8_t *data, uint16_t len)
+{
+    I2C_Status status;
+
+    /* TXE마다 DR을 채워 시프트 레지스터가 쉬지 않도록 함 - BTF는 호출자가 마지막에 한 번만 확인 */
+    while (len--)
+    {
+        status = I2C_WaitFlag(I2Cx, I2C_SR1_TXE);
+        if (status != I2C_OK)
+            return status;
+
+        I2Cx->DR = *data++;
+    }
+
+    return I2C_OK;
+}
+
+/* 여러 바이트 수신 내부 함수 (ADDR 설정 이후, 클리어 이전에 호출) */
+static I2C_Status I2C_ReceiveBytes(I2C_TypeDef *I2Cx, uint8_t *data, uint16_t len)
+{
+    I2C_Status status;
+
+    if (len == 1)
+    {
+        /* N=1: ADDR 클리어 전에 NACK 설정, 클리어 직후 정지 조건 예약 */
+        I2Cx->CR1.b.ACK = 0;
+        (void)I2Cx->SR2;
+        I2C_Stop(I2Cx);
+
+        status = I2C_WaitFlag(I2Cx, I2C_SR1_RXNE);
+        if (status != I2C_OK)
+            return status;
+
+        *data = I2Cx->DR;
+        return I2C_OK;
+    }
+
+    if (len == 2)
+    {
+        /* N=2: POS로 두 번째 바이트에 NACK 예약, 두 바이트가 모두 도착(BTF)하면 일괄 읽기 */
+        I2Cx->CR1.b.ACK = 0;
+        I2Cx->CR1.b.POS = 1;
+        (void)I2Cx->SR2;
+
+        status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+        I2Cx->CR1.b.POS = 0;
+        if (status != I2C_OK)
+            return status;
+
+        I2C_Stop(I2Cx);
+        *data++ = I2Cx->DR;
+        *data = I2Cx->DR;
+        return I2C_OK;
+    }
+
+    /* N>2: 마지막 3바이트 전까지 ACK로 수신 */
+    I2Cx->CR1.b.ACK = 1;
+    (void)I2Cx->SR2;
+
+    while (len > 3)
+    {
+        status = I2C_WaitFlag(I2Cx, I2C_SR1_RXNE);
+        if (status != I2C_OK)
+            return status;
+
+        *data++ = I2Cx->DR;
+        len--;
+
+        /* DR과 시프트 레지스터가 모두 찬 경우 이어서 한 바이트 더 읽기 */
+        if (len > 3 && I2Cx->SR1.b.BTF)
+        {
+            *data++ = I2Cx->DR;
+            len--;
+        }
+    }
+
+    /* DR에 N-2, 시프트 레지스터에 N-1 - 마지막 바이트에 NACK 예약 */
+    status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+    if (status != I2C_OK)
+        return status;
+
+    I2Cx->CR1.b.ACK = 0;
+    *data++ = I2Cx->DR;
+
+    /* DR에 N-1, 시프트 레지스터에 N - 정지 조건 후 두 바이트 읽기 */
+    status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+    if (status != I2C_OK)
+        return status;
+
+    I2C_Stop(I2Cx);
+    *data++ = I2Cx->DR;
+    *data = I2Cx->DR;
+
+    return I2C_OK;
+}
+
+/* 여러 바이트 데이터 쓰기 (1회 시도) 내부 함수 */
+static I2C_Status I2C_WriteDataOnce(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len)
 {
     /* 널 포인터 체크 */
     assert(I2Cx != NULL);
@@ -217,7 +649,6 @@ I2C_Status I2C_WriteData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, ui
     assert(len > 0);
 
     I2C_Status status;
-    uint32_t timeout = I2C_TIMEOUT_DEFAULT;
 
     /* 시작 조건 생성 */
     status = I2C_Start(I2Cx);
@@ -225,26 +656,21 @@ I2C_Status I2C_WriteData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, ui
         return status;
 
     /* 슬레이브 주소 전송 (쓰기) */
-    I2Cx->DR = (slaveAddr << 1) & 0xFE;
-
-    /* ADDR 플래그 대기 */
-    while (!I2Cx->SR1.b.ADDR)
-    {
-        if (--timeout == 0)
-        {
-            return I2C_TIMEOUT;
-        }
-    }
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) & 0xFE);
+    if (status != I2C_OK)
+        return status;
     /* ADDR 플래그 클리어 */
     (void)I2Cx->SR2;
 
     /* 데이터 전송 */
-    while (len--)
-    {
-        status = I2C_WriteByte(I2Cx, *data++);
-        if (status != I2C_OK)
-            return status;
-    }
+    status = I2C_TransmitBytes(I2Cx, data, len);
+    if (status != I2C_OK)
+        return status;
+
+    /* 마지막 바이트 전송 완료 대기 */
+    status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+    if (status != I2C_OK)
+        return status;
 
     /* 정지 조건 생성 */
     I2C_Stop(I2Cx);
@@ -252,8 +678,8 @@ I2C_Status I2C_WriteData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, ui
     return I2C_OK;
 }
 
-/* 여러 바이트 데이터 읽기 */
-I2C_Status I2C_ReadData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len)
+/* 여러 바이트 데이터 읽기 (1회 시도) 내부 함수 */
+static I2C_Status I2C_ReadDataOnce(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len)
 {
     /* 널 포인터 체크 */
     assert(I2Cx != NULL);
@@ -262,7 +688,6 @@ I2C_Status I2C_ReadData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uin
     assert(len > 0);
 
     I2C_Status status;
-    uint32_t timeout = I2C_TIMEOUT_DEFAULT;
 
     /* 시작 조건 생성 */
     status = I2C_Start(I2Cx);
@@ -270,38 +695,1512 @@ I2C_Status I2C_ReadData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uin
         return status;
 
     /* 슬레이브 주소 전송 (읽기) */
-    I2Cx->DR = (slaveAddr << 1) | 0x01;
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) | 0x01);
+    if (status != I2C_OK)
+        return status;
 
-    /* ADDR 플래그 대기 */
-    while (!I2Cx->SR1.b.ADDR)
-    {
-        if (--timeout == 0)
-        {
-            return I2C_TIMEOUT;
-        }
-    }
+    /* 데이터 수신 (ADDR 클리어 및 정지 조건 생성 포함) */
+    return I2C_ReceiveBytes(I2Cx, data, len);
+}
+
+/* 반복 시작 조건을 이용한 쓰기 후 읽기 (1회 시도) 내부 함수 */
+static I2C_Status I2C_WriteReadDataOnce(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *txData, uint16_t txLen, uint8_t *rxData, uint16_t rxLen)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(txData != NULL);
+    assert(rxData != NULL);
+    /* 데이터 길이 체크 */
+    assert(txLen > 0);
+    assert(rxLen > 0);
+
+    I2C_Status status;
+
+    /* 시작 조건 생성 */
+    status = I2C_Start(I2Cx);
+    if (status != I2C_OK)
+        return status;
+
+    /* 슬레이브 주소 전송 (쓰기) */
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) & 0xFE);
+    if (status != I2C_OK)
+        return status;
     /* ADDR 플래그 클리어 */
     (void)I2Cx->SR2;
 
-    /* 데이터 수신 */
-    while (len)
-    {
-        if (len == 1)
-        {                                         // 마지막 바이트
-            status = I2C_ReadByte(I2Cx, data, 0); // NACK
-        }
-        else
-        {
-            status = I2C_ReadByte(I2Cx, data, 1); // ACK
-        }
-        if (status != I2C_OK)
-            return status;
-        data++;
-        len--;
-    }
+    /* 쓰기 단계 데이터 전송 */
+    status = I2C_TransmitBytes(I2Cx, txData, txLen);
+    if (status != I2C_OK)
+        return status;
 
-    /* 정지 조건 생성 */
-    I2C_Stop(I2Cx);
+    /* 마지막 바이트 전송 완료 대기 */
+    status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+    if (status != I2C_OK)
+        return status;
+
+    /* 반복 시작 조건 생성 - 정지 조건 없이 버스 점유 유지 */
+    status = I2C_Start(I2Cx);
+    if (status != I2C_OK)
+        return status;
+
+    /* 슬레이브 주소 전송 (읽기) */
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) | 0x01);
+    if (status != I2C_OK)
+        return status;
+
+    /* 데이터 수신 (ADDR 클리어 및 정지 조건 생성 포함) */
+    return I2C_ReceiveBytes(I2Cx, rxData, rxLen);
+}
+
+/* 메모리 주소를 빅엔디안 바이트 배열로 변환하는 내부 함수 */
+static uint16_t I2C_PackMemAddress(uint8_t *buf, uint16_t memAddr, I2C_MemAddSize memAddSize)
+{
+    if (memAddSize == I2C_MEMADD_SIZE_16BIT)
+    {
+        buf[0] = (uint8_t)(memAddr >> 8);
+        buf[1] = (uint8_t)(memAddr & 0xFF);
+        return 2;
+    }
+
+    buf[0] = (uint8_t)(memAddr & 0xFF);
+    return 1;
+}
+
+/* 슬레이브 레지스터(메모리) 쓰기 (1회 시도) 내부 함수 */
+static I2C_Status I2C_MemWriteOnce(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint16_t memAddr, I2C_MemAddSize memAddSize, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    I2C_Status status;
+    uint8_t mem_buf[2];
+    uint16_t mem_len = I2C_PackMemAddress(mem_buf, memAddr, memAddSize);
+
+    /* 시작 조건 생성 */
+    status = I2C_Start(I2Cx);
+    if (status != I2C_OK)
+        return status;
+
+    /* 슬레이브 주소 전송 (쓰기) */
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) & 0xFE);
+    if (status != I2C_OK)
+        return status;
+    /* ADDR 플래그 클리어 */
+    (void)I2Cx->SR2;
+
+    /* 레지스터 주소와 데이터를 하나의 트랜잭션으로 전송 */
+    status = I2C_TransmitBytes(I2Cx, mem_buf, mem_len);
+    if (status != I2C_OK)
+        return status;
+
+    status = I2C_TransmitBytes(I2Cx, data, len);
+    if (status != I2C_OK)
+        return status;
+
+    /* 마지막 바이트 전송 완료 대기 */
+    status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+    if (status != I2C_OK)
+        return status;
+
+    /* 정지 조건 생성 */
+    I2C_Stop(I2Cx);
+
+    return I2C_OK;
+}
+
+/* 중재 손실 백오프 시간 계산 내부 함수 (xorshift32 난수, 시도마다 구간 2배, MaxBackoffUs로 제한) */
+static uint32_t I2C_BackoffUs(uint8_t idx, const I2C_RetryPolicy *policy, uint8_t attempt)
+{
+    uint32_t x = i2c_backoff_seed[idx] ? i2c_backoff_seed[idx] : 1;
+    uint32_t window = (uint32_t)(policy->MinBackoffUs ? policy->MinBackoffUs : 1) << (attempt < 15 ? attempt : 15);
+    uint32_t upper = policy->MinBackoffUs + window;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    i2c_backoff_seed[idx] = x;
+
+    if (upper > policy->MaxBackoffUs)
+    {
+        upper = policy->MaxBackoffUs;
+    }
+    if (upper <= policy->MinBackoffUs)
+    {
+        return policy->MinBackoffUs;
+    }
+
+    return policy->MinBackoffUs + x % (upper - policy->MinBackoffUs + 1);
+}
+
+/* 중재 손실 재시도 판단 내부 함수 (재시도하는 경우 백오프 대기 후 1 반환) */
+static uint8_t I2C_RetryAfterArbitrationLoss(I2C_TypeDef *I2Cx, const I2C_RetryPolicy *policy, I2C_Status status, uint8_t attempt)
+{
+    uint8_t idx = I2C_GetIndex(I2Cx);
+
+    if (status != I2C_ARBITRATION_LOST)
+    {
+        return 0;
+    }
+    if (attempt >= policy->MaxRetries)
+    {
+        i2c_stats[idx].RetryExhausted++;
+        return 0;
+    }
+
+    i2c_stats[idx].Retries++;
+    I2C_DelayUs(I2C_BackoffUs(idx, policy, attempt));
+
+    return 1;
+}
+
+/* 중재 손실 재시도 정책 설정 */
+void I2C_SetRetryPolicy(I2C_TypeDef *I2Cx, const I2C_RetryPolicy *policy)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(policy != NULL);
+    /* 백오프 범위 체크 */
+    assert(policy->MinBackoffUs <= policy->MaxBackoffUs);
+
+    i2c_retry_policy[I2C_GetIndex(I2Cx)] = *policy;
+}
+
+/* 통신 통계 조회 */
+void I2C_GetStats(I2C_TypeDef *I2Cx, I2C_Stats *stats)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(stats != NULL);
+
+    *stats = i2c_stats[I2C_GetIndex(I2Cx)];
+}
+
+/* 통신 통계 초기화 */
+void I2C_ResetStats(I2C_TypeDef *I2Cx)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+
+    I2C_Stats *stats = &i2c_stats[I2C_GetIndex(I2Cx)];
+
+    stats->ArbitrationLost = 0;
+    stats->Retries = 0;
+    stats->RetryExhausted = 0;
+}
+
+/* 트랜잭션 실행 (중재 손실 시 재시도) */
+I2C_Status I2C_Transfer(I2C_TypeDef *I2Cx, I2C_Transaction *xfer)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(xfer != NULL);
+    /* 데이터 길이 체크 */
+    assert(xfer->TxSize > 0 || xfer->RxSize > 0);
+
+    const I2C_RetryPolicy *policy = xfer->pRetry ? xfer->pRetry : &i2c_retry_policy[I2C_GetIndex(I2Cx)];
+    I2C_Status status;
+    uint8_t attempt = 0;
+
+    do
+    {
+        if (xfer->TxSize > 0 && xfer->RxSize > 0)
+        {
+            status = I2C_WriteReadDataOnce(I2Cx, xfer->DevAddress, xfer->pTxBuffer, xfer->TxSize, xfer->pRxBuffer, xfer->RxSize);
+        }
+        else if (xfer->RxSize > 0)
+        {
+            status = I2C_ReadDataOnce(I2Cx, xfer->DevAddress, xfer->pRxBuffer, xfer->RxSize);
+        }
+        else
+        {
+            status = I2C_WriteDataOnce(I2Cx, xfer->DevAddress, xfer->pTxBuffer, xfer->TxSize);
+        }
+    } while (I2C_RetryAfterArbitrationLoss(I2Cx, policy, status, attempt++));
+
+    xfer->Status = status;
+
+    return status;
+}
+
+/* 여러 바이트 데이터 쓰기 */
+I2C_Status I2C_WriteData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(data != NULL);
+
+    I2C_Transaction xfer = {.DevAddress = slaveAddr, .pTxBuffer = data, .TxSize = len};
+
+    return I2C_Transfer(I2Cx, &xfer);
+}
+
+/* 여러 바이트 데이터 읽기 */
+I2C_Status I2C_ReadData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(data != NULL);
+
+    I2C_Transaction xfer = {.DevAddress = slaveAddr, .pRxBuffer = data, .RxSize = len};
+
+    return I2C_Transfer(I2Cx, &xfer);
+}
+
+/* 반복 시작 조건을 이용한 쓰기 후 읽기 */
+I2C_Status I2C_WriteReadData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *txData, uint16_t txLen, uint8_t *rxData, uint16_t rxLen)
+{
+    /* 널 포인터 체크 */
+    assert(txData != NULL);
+    assert(rxData != NULL);
+    /* 데이터 길이 체크 */
+    assert(txLen > 0);
+    assert(rxLen > 0);
+
+    I2C_Transaction xfer = {.DevAddress = slaveAddr, .pTxBuffer = txData, .TxSize = txLen, .pRxBuffer = rxData, .RxSize = rxLen};
+
+    return I2C_Transfer(I2Cx, &xfer);
+}
+
+/* 슬레이브 레지스터(메모리) 쓰기 */
+I2C_Status I2C_MemWrite(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint16_t memAddr, I2C_MemAddSize memAddSize, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+
+    const I2C_RetryPolicy *policy = &i2c_retry_policy[I2C_GetIndex(I2Cx)];
+    I2C_Status status;
+    uint8_t attempt = 0;
+
+    do
+    {
+        status = I2C_MemWriteOnce(I2Cx, slaveAddr, memAddr, memAddSize, data, len);
+    } while (I2C_RetryAfterArbitrationLoss(I2Cx, policy, status, attempt++));
+
+    return status;
+}
+
+/* 슬레이브 레지스터(메모리) 읽기 */
+I2C_Status I2C_MemRead(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint16_t memAddr, I2C_MemAddSize memAddSize, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    uint8_t mem_buf[2];
+    uint16_t mem_len = I2C_PackMemAddress(mem_buf, memAddr, memAddSize);
+
+    return I2C_WriteReadData(I2Cx, slaveAddr, mem_buf, mem_len, data, len);
+}
+
+/* 주소만 전송하여 응답을 확인하는 내부 함수 (ACK: I2C_OK, NACK: I2C_ERROR) */
+static I2C_Status I2C_Probe(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint32_t addrTimeout)
+{
+    I2C_Status status;
+    uint32_t timeout = I2C_TIMEOUT_DEFAULT;
+
+    /* 시작 조건 생성 */
+    status = I2C_Start(I2Cx);
+    if (status != I2C_OK)
+        return status;
+
+    /* 주소만 전송 - NACK(AF)이면 I2C_SendAddressTimeout이 AF 클리어 및 정지 조건 생성 */
+    status = I2C_SendAddressTimeout(I2Cx, (slaveAddr << 1) & 0xFE, addrTimeout);
+    if (status == I2C_OK)
+    {
+        /* ADDR 플래그 클리어 후 바로 정지 조건 생성 */
+        (void)I2Cx->SR2;
+        I2C_Stop(I2Cx);
+    }
+    else if (status == I2C_TIMEOUT)
+    {
+        I2C_Stop(I2Cx);
+    }
+
+    /* 다음 시작 조건 전에 정지 조건 생성 완료 대기 */
+    while (I2Cx->CR1.b.STOP && --timeout)
+        ;
+
+    return status;
+}
+
+/* 장치 응답 확인 (주소만 전송) */
+I2C_Status I2C_IsDeviceReady(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint32_t trials)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+
+    I2C_Status status;
+
+    while (trials--)
+    {
+        status = I2C_Probe(I2Cx, slaveAddr, I2C_TIMEOUT_DEFAULT);
+
+        /* 응답(ACK), 타임아웃, 중재 손실은 즉시 반환 - NACK만 다시 시도 */
+        if (status != I2C_ERROR)
+            return status;
+    }
+
+    return I2C_BUSY;
+}
+
+/* 버스 주소 스캔 */
+I2C_Status I2C_Scan(I2C_TypeDef *I2Cx, const uint8_t *candidates, uint8_t count, uint8_t *bitmap)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(bitmap != NULL);
+
+    I2C_Status status;
+    uint8_t addr;
+    uint8_t total = candidates ? count : (I2C_SCAN_LAST_ADDRESS - I2C_SCAN_FIRST_ADDRESS + 1);
+
+    for (uint8_t i = 0; i < 16; i++)
+    {
+        bitmap[i] = 0;
+    }
+
+    for (uint8_t i = 0; i < total; i++)
+    {
+        addr = candidates ? (candidates[i] & 0x7F) : (I2C_SCAN_FIRST_ADDRESS + i);
+
+        status = I2C_Probe(I2Cx, addr, I2C_SCAN_TIMEOUT);
+        if (status == I2C_OK)
+        {
+            bitmap[addr >> 3] |= (uint8_t)(1U << (addr & 0x07));
+        }
+        else if (status != I2C_ERROR && status != I2C_TIMEOUT)
+        {
+            /* 중재 손실, 버스 고착 등은 스캔 중단 */
+            return status;
+        }
+    }
+
+    return I2C_OK;
+}
+
+/* SMBus 블록 쓰기 */
+I2C_Status I2C_SMBus_BlockWrite(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t command, uint8_t *data, uint8_t len)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    I2C_Status status;
+    uint8_t header[2] = {command, len};
+
+    /* 시작 조건 생성 */
+    status = I2C_Start(I2Cx);
+    if (status != I2C_OK)
+        return status;
+
+    /* 슬레이브 주소 전송 (쓰기) */
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) & 0xFE);
+    if (status != I2C_OK)
+        return status;
+    /* ADDR 플래그 클리어 */
+    (void)I2Cx->SR2;
+
+    /* 커맨드, 바이트 수, 데이터 전송 */
+    status = I2C_TransmitBytes(I2Cx, header, 2);
+    if (status != I2C_OK)
+        return status;
+
+    status = I2C_TransmitBytes(I2Cx, data, len);
+    if (status != I2C_OK)
+        return status;
+
+    /* 마지막 TXE 이후 PEC 비트 설정 - 하드웨어가 계산한 PEC 바이트를 이어서 전송 */
+    if (I2Cx->CR1.b.ENPEC)
+    {
+        status = I2C_WaitFlag(I2Cx, I2C_SR1_TXE);
+        if (status != I2C_OK)
+            return status;
+
+        I2Cx->CR1.b.PEC = 1;
+    }
+
+    /* 마지막 바이트(PEC 포함) 전송 완료 대기 */
+    status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+    if (status != I2C_OK)
+        return status;
+
+    /* 정지 조건 생성 */
+    I2C_Stop(I2Cx);
+
+    return I2C_OK;
+}
+
+/* SMBus 블록 읽기 오류 종료 내부 함수 - POS/PEC 해제, ACK 복원 후 마스터이면 정지 조건 생성 */
+static I2C_Status I2C_SMBus_ReadAbort(I2C_TypeDef *I2Cx, I2C_Status status)
+{
+    I2Cx->CR1.b.POS = 0;
+    I2Cx->CR1.b.PEC = 0;
+    I2Cx->CR1.b.ACK = 1;
+
+    /* 중재 손실 후에는 이미 슬레이브 모드이므로 정지 조건을 생성하지 않음 */
+    if (I2Cx->SR2.b.MSL)
+    {
+        I2C_Stop(I2Cx);
+    }
+
+    return status;
+}
+
+/* SMBus 블록 읽기 */
+I2C_Status I2C_SMBus_BlockRead(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t command, uint8_t *data, uint8_t *len)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(data != NULL);
+    assert(len != NULL);
+
+    I2C_Status status;
+    uint8_t pec = I2Cx->CR1.b.ENPEC;
+    uint8_t count;
+    uint16_t remaining;
+
+    /* 시작 조건 생성 */
+    status = I2C_Start(I2Cx);
+    if (status != I2C_OK)
+        return status;
+
+    /* 슬레이브 주소 전송 (쓰기) 후 커맨드 전송 */
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) & 0xFE);
+    if (status != I2C_OK)
+        return status;
+    /* ADDR 플래그 클리어 */
+    (void)I2Cx->SR2;
+
+    status = I2C_TransmitBytes(I2Cx, &command, 1);
+    if (status != I2C_OK)
+        return I2C_SMBus_ReadAbort(I2Cx, status);
+
+    status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+    if (status != I2C_OK)
+        return I2C_SMBus_ReadAbort(I2Cx, status);
+
+    /* 반복 시작 조건 생성 - PEC 계산은 정지 조건 전까지 이어짐 */
+    status = I2C_Start(I2Cx);
+    if (status != I2C_OK)
+        return I2C_SMBus_ReadAbort(I2Cx, status);
+
+    /* 슬레이브 주소 전송 (읽기) */
+    I2Cx->CR1.b.ACK = 1;
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) | 0x01);
+    if (status != I2C_OK)
+        return I2C_SMBus_ReadAbort(I2Cx, status);
+    /* ADDR 플래그 클리어 */
+    (void)I2Cx->SR2;
+
+    /* 바이트 수 수신 */
+    status = I2C_WaitFlag(I2Cx, I2C_SR1_RXNE);
+    if (status != I2C_OK)
+        return I2C_SMBus_ReadAbort(I2Cx, status);
+    count = (uint8_t)I2Cx->DR;
+
+    /* 바이트 수가 0이거나 버퍼보다 크면 다음 바이트를 NACK하고 중단 */
+    if (count == 0 || count > *len)
+    {
+        I2Cx->CR1.b.ACK = 0;
+        I2C_Stop(I2Cx);
+        if (I2C_WaitFlag(I2Cx, I2C_SR1_RXNE) == I2C_OK)
+        {
+            (void)I2Cx->DR;
+        }
+        return I2C_SMBus_ReadAbort(I2Cx, I2C_ERROR);
+    }
+
+    /* 남은 수신 바이트: 데이터 + PEC */
+    remaining = count + (pec ? 1 : 0);
+
+    if (remaining == 1)
+    {
+        /* 다음 바이트가 마지막: 즉시 NACK 및 정지 조건 예약 */
+        I2Cx->CR1.b.ACK = 0;
+        I2C_Stop(I2Cx);
+    }
+    else if (remaining == 2)
+    {
+        /* 시프트 중인 바이트는 ACK, 그 다음(마지막) 바이트는 NACK */
+        I2Cx->CR1.b.POS = 1;
+        I2Cx->CR1.b.ACK = 0;
+        if (pec)
+        {
+            I2Cx->CR1.b.PEC = 1;
+        }
+
+        status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+        if (status != I2C_OK)
+            return I2C_SMBus_ReadAbort(I2Cx, status);
+
+        I2C_Stop(I2Cx);
+        *data++ = (uint8_t)I2Cx->DR;
+        I2Cx->CR1.b.POS = 0;
+        remaining--;
+    }
+    else
+    {
+        /* 마지막 3바이트 전까지는 RXNE마다 읽음 */
+        while (remaining > 3)
+        {
+            status = I2C_WaitFlag(I2Cx, I2C_SR1_RXNE);
+            if (status != I2C_OK)
+                return I2C_SMBus_ReadAbort(I2Cx, status);
+
+            *data++ = (uint8_t)I2Cx->DR;
+            remaining--;
+        }
+
+        /* N-2 바이트가 DR, N-1 바이트가 시프트 레지스터에 있을 때 NACK 및 PEC 비교 예약 */
+        status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+        if (status != I2C_OK)
+            return I2C_SMBus_ReadAbort(I2Cx, status);
+
+        I2Cx->CR1.b.ACK = 0;
+        if (pec)
+        {
+            I2Cx->CR1.b.PEC = 1;
+        }
+        *data++ = (uint8_t)I2Cx->DR;
+
+        status = I2C_WaitFlag(I2Cx, I2C_SR1_BTF);
+        if (status != I2C_OK)
+            return I2C_SMBus_ReadAbort(I2Cx, status);
+
+        I2C_Stop(I2Cx);
+        *data++ = (uint8_t)I2Cx->DR;
+        remaining -= 2;
+    }
+
+    /* 마지막 바이트 (PEC 사용 시 PEC 바이트) */
+    status = I2C_WaitFlag(I2Cx, I2C_SR1_RXNE);
+    if (status != I2C_OK)
+        return I2C_SMBus_ReadAbort(I2Cx, status);
+
+    if (pec)
+    {
+        (void)I2Cx->DR;
+    }
+    else
+    {
+        *data = (uint8_t)I2Cx->DR;
+    }
+
+    *len = count;
+    I2Cx->CR1.b.ACK = 1;
+
+    /* 하드웨어 PEC 비교 결과 확인 */
+    if (I2Cx->SR1.b.PECERR)
+    {
+        I2Cx->SR1.b.PECERR = 0;
+        return I2C_PEC_ERROR;
+    }
+
+    return I2C_OK;
+}
+
+/* I2C DMA 스트림 설정 내부 함수 */
+static void I2C_DMAConfig(I2C_TypeDef *I2Cx, DMA_Stream stream, DMA_Direction direction, uint8_t *data, uint16_t len)
+{
+    const I2C_DMAMap *map = &i2c_dma_map[I2C_GetIndex(I2Cx)];
+    DMA_Config dma_config = {
+        .Channel = map->Channel,
+        .Direction = direction,
+        .MemInc = DMA_INCREMENT_ENABLE,
+        .PeriphInc = DMA_INCREMENT_DISABLE,
+        .MemDataSize = DMA_SIZE_BYTE,
+        .PeriphDataSize = DMA_SIZE_BYTE,
+        .Mode = DMA_MODE_NORMAL,
+        .Priority = DMA_PRIORITY_HIGH,
+        .FIFOMode = 0,
+        .FIFOThreshold = DMA_FIFO_THRESHOLD_1_4,
+        .MemBurst = DMA_BURST_SINGLE,
+        .PeriphBurst = DMA_BURST_SINGLE
+    };
+
+    DMA_Init(DMA1, stream, &dma_config);
+
+    if (direction == DMA_DIR_MEMORY_TO_PERIPH)
+    {
+        DMA_ConfigTransfer(DMA1, stream, (uint32_t)data, (uint32_t)&I2Cx->DR, len);
+    }
+    else
+    {
+        DMA_ConfigTransfer(DMA1, stream, (uint32_t)&I2Cx->DR, (uint32_t)data, len);
+    }
+
+    /* 전송 완료 및 전송 오류 인터럽트 활성화 */
+    DMA_EnableInterrupts(DMA1, stream, 1, 0, 1, 0);
+    DMA_Enable(DMA1, stream);
+}
+
+/* I2C DMA 전송 정리 내부 함수 (stop: 정지 조건 생성 여부) */
+static void I2C_DMAStop(I2C_TypeDef *I2Cx, uint8_t stop)
+{
+    I2C_DMAContext *ctx = &i2c_dma_ctx[I2C_GetIndex(I2Cx)];
+    const I2C_DMAMap *map = &i2c_dma_map[I2C_GetIndex(I2Cx)];
+    DMA_Stream stream = ctx->Receive ? map->RxStream : map->TxStream;
+
+    DMA_DisableInterrupts(DMA1, stream);
+    DMA_Disable(DMA1, stream);
+    DMA_ClearFlags(DMA1, stream);
+
+    /* DMA 요청 및 이벤트/에러 인터럽트 비활성화 */
+    I2Cx->CR2.b.DMAEN = 0;
+    I2Cx->CR2.b.LAST = 0;
+    I2Cx->CR2.b.ITEVTEN = 0;
+    I2Cx->CR2.b.ITERREN = 0;
+
+    if (stop && !ctx->StopIssued)
+    {
+        I2C_Stop(I2Cx);
+    }
+
+    ctx->WaitBTF = 0;
+    ctx->Busy = 0;
+}
+
+/* I2C DMA 전송 종료 및 콜백 호출 내부 함수 */
+static void I2C_DMAComplete(I2C_TypeDef *I2Cx, I2C_Status status, uint8_t stop)
+{
+    I2C_DMAContext *ctx = &i2c_dma_ctx[I2C_GetIndex(I2Cx)];
+
+    I2C_DMAStop(I2Cx, stop);
+
+    if (ctx->Callback != NULL)
+    {
+        ctx->Callback(I2Cx, status);
+    }
+}
+
+/* 주소 단계 완료 후 DMA 요청 및 에러 인터럽트 활성화 내부 함수 (ADDR 클리어 전 호출) */
+static void I2C_DMAEnable(I2C_TypeDef *I2Cx)
+{
+    /* 데이터 단계의 NACK/중재 손실/버스 에러는 에러 인터럽트로 감지 */
+    I2Cx->CR2.b.ITERREN = 1;
+    I2Cx->CR2.b.DMAEN = 1;
+}
+
+/* DMA를 사용한 여러 바이트 데이터 쓰기 */
+I2C_Status I2C_WriteData_DMA(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len, I2C_DMACallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    I2C_DMAContext *ctx = &i2c_dma_ctx[I2C_GetIndex(I2Cx)];
+    I2C_Status status;
+
+    if (ctx->Busy)
+    {
+        return I2C_BUSY;
+    }
+
+    ctx->Busy = 1;
+    ctx->Receive = 0;
+    ctx->StopIssued = 0;
+    ctx->WaitBTF = 0;
+    ctx->Callback = callback;
+
+    /* DMA 스트림 준비 (TXE 요청 대기 상태) */
+    I2C_DMAConfig(I2Cx, i2c_dma_map[I2C_GetIndex(I2Cx)].TxStream, DMA_DIR_MEMORY_TO_PERIPH, data, len);
+
+    /* 시작 조건 생성 */
+    status = I2C_Start(I2Cx);
+    if (status != I2C_OK)
+    {
+        I2C_DMAStop(I2Cx, status == I2C_TIMEOUT);
+        return status;
+    }
+
+    /* 슬레이브 주소 전송 (쓰기) - NACK이면 정지 조건까지 생성됨 */
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) & 0xFE);
+    if (status != I2C_OK)
+    {
+        I2C_DMAStop(I2Cx, status == I2C_TIMEOUT);
+        return status;
+    }
+
+    /* DMA 요청 활성화 후 ADDR 플래그 클리어 - 이후 데이터는 DMA가 전송 */
+    I2C_DMAEnable(I2Cx);
+    (void)I2Cx->SR2;
+
+    return I2C_OK;
+}
+
+/* DMA를 사용한 여러 바이트 데이터 읽기 */
+I2C_Status I2C_ReadData_DMA(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len, I2C_DMACallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    I2C_DMAContext *ctx = &i2c_dma_ctx[I2C_GetIndex(I2Cx)];
+    I2C_Status status;
+
+    if (ctx->Busy)
+    {
+        return I2C_BUSY;
+    }
+
+    ctx->Busy = 1;
+    ctx->Receive = 1;
+    ctx->StopIssued = 0;
+    ctx->WaitBTF = 0;
+    ctx->Callback = callback;
+
+    /* DMA 스트림 준비 (RXNE 요청 대기 상태) */
+    I2C_DMAConfig(I2Cx, i2c_dma_map[I2C_GetIndex(I2Cx)].RxStream, DMA_DIR_PERIPH_TO_MEMORY, data, len);
+
+    /* ACK 및 LAST 설정 - LAST가 설정되면 마지막 DMA 전송 후 자동으로 NACK 전송 */
+    if (len == 1)
+    {
+        I2Cx->CR1.b.ACK = 0;
+    }
+    else
+    {
+        I2Cx->CR1.b.ACK = 1;
+        I2Cx->CR2.b.LAST = 1;
+    }
+
+    /* 시작 조건 생성 */
+    status = I2C_Start(I2Cx);
+    if (status != I2C_OK)
+    {
+        I2C_DMAStop(I2Cx, status == I2C_TIMEOUT);
+        return status;
+    }
+
+    /* 슬레이브 주소 전송 (읽기) - NACK이면 정지 조건까지 생성됨 */
+    status = I2C_SendAddress(I2Cx, (slaveAddr << 1) | 0x01);
+    if (status != I2C_OK)
+    {
+        I2C_DMAStop(I2Cx, status == I2C_TIMEOUT);
+        return status;
+    }
+
+    /* DMA 요청 활성화 후 ADDR 플래그 클리어 */
+    I2C_DMAEnable(I2Cx);
+    (void)I2Cx->SR2;
+
+    /* 1바이트 수신은 ADDR 클리어 직후 정지 조건을 예약해야 함 */
+    if (len == 1)
+    {
+        I2C_Stop(I2Cx);
+        ctx->StopIssued = 1;
+    }
+
+    return I2C_OK;
+}
+
+/* DMA 전송 중단 */
+void I2C_AbortDMA(I2C_TypeDef *I2Cx)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+
+    I2C_DMAContext *ctx = &i2c_dma_ctx[I2C_GetIndex(I2Cx)];
+
+    if (!ctx->Busy)
+    {
+        return;
+    }
+
+    /* 마스터 상태일 때만 정지 조건으로 버스 해제 (중재 손실 후에는 이미 슬레이브) */
+    I2C_DMAStop(I2Cx, I2Cx->SR2.b.MSL);
+}
+
+/* I2C DMA 인터럽트 핸들러 (DMA 스트림, 이벤트, 에러 공용) */
+void I2C_DMA_IRQHandler(I2C_TypeDef *I2Cx)
+{
+    /* 널 포인터 체크 */
+    assert(I2Cx != NULL);
+
+    I2C_DMAContext *ctx = &i2c_dma_ctx[I2C_GetIndex(I2Cx)];
+    const I2C_DMAMap *map = &i2c_dma_map[I2C_GetIndex(I2Cx)];
+    DMA_Stream stream = ctx->Receive ? map->RxStream : map->TxStream;
+
+    if (!ctx->Busy)
+    {
+        return;
+    }
+
+    /* 데이터 단계 에러 (ITERREN) */
+    if (I2Cx->SR1.b.ARLO)
+    {
+        /* 인터페이스가 이미 슬레이브 모드로 전환되었으므로 정지 조건을 생성하지 않음 */
+        I2C_DMAComplete(I2Cx, I2C_ArbitrationLost(I2Cx), 0);
+        return;
+    }
+    if (I2Cx->SR1.b.AF)
+    {
+        I2Cx->SR1.b.AF = 0;
+        I2C_DMAComplete(I2Cx, I2C_ERROR, 1);
+        return;
+    }
+    if (I2Cx->SR1.b.BERR)
+    {
+        I2Cx->SR1.b.BERR = 0;
+        I2C_DMAComplete(I2Cx, I2C_ERROR, 1);
+        return;
+    }
+
+    /* 송신: 마지막 바이트가 시프트 레지스터에서 나가면(BTF 이벤트) 정지 조건 생성 */
+    if (ctx->WaitBTF)
+    {
+        if (I2Cx->SR1.b.BTF)
+        {
+            I2C_DMAComplete(I2Cx, I2C_OK, 1);
+        }
+        return;
+    }
+
+    if (DMA_IsTransferError(DMA1, stream))
+    {
+        I2C_DMAComplete(I2Cx, I2C_ERROR, 1);
+        return;
+    }
+    if (!DMA_IsTransferComplete(DMA1, stream))
+    {
+        return;
+    }
+
+    DMA_ClearFlags(DMA1, stream);
+    DMA_DisableInterrupts(DMA1, stream);
+    I2Cx->CR2.b.DMAEN = 0;
+
+    /* 송신: ISR에서 BTF를 기다리지 않고 이벤트 인터럽트로 완료 처리 */
+    if (!ctx->Receive)
+    {
+        ctx->WaitBTF = 1;
+        I2Cx->CR2.b.ITEVTEN = 1;
+        return;
+    }
+
+    /* 수신: LAST로 마지막 바이트에 NACK이 전송되었으므로 바로 정지 조건 생성 */
+    I2C_DMAComplete(I2Cx, I2C_OK, 1);
+}
+
+/* 인터럽트 전송 종료 내부 함수 */
+static void I2C_IT_Complete(I2C_Handle *hi2c, I2C_Status status)
+{
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+
+    /* 이벤트/버퍼/에러 인터럽트 비활성화 */
+    I2Cx->CR2.b.ITEVTEN = 0;
+    I2Cx->CR2.b.ITBUFEN = 0;
+    I2Cx->CR2.b.ITERREN = 0;
+    I2Cx->CR1.b.POS = 0;
+
+    /* 배치 전송 중이면 현재 트랜잭션에 결과 기록 */
+    if (hi2c->pBatch != NULL)
+    {
+        hi2c->pBatch[hi2c->BatchIndex].Status = status;
+    }
+
+    hi2c->ErrorCode = status;
+    hi2c->State = I2C_STATE_READY;
+
+    if (status == I2C_OK)
+    {
+        if (hi2c->XferCpltCallback != NULL)
+        {
+            hi2c->XferCpltCallback(hi2c);
+        }
+    }
+    else if (hi2c->ErrorCallback != NULL)
+    {
+        hi2c->ErrorCallback(hi2c);
+    }
+}
+
+/* 트랜잭션 버퍼 설정 내부 함수 */
+static void I2C_IT_Load(I2C_Handle *hi2c, uint8_t slaveAddr, uint8_t *txData, uint16_t txLen, uint8_t *rxData, uint16_t rxLen)
+{
+    hi2c->DevAddress = slaveAddr;
+    hi2c->pTxBuffer = txData;
+    hi2c->TxSize = txLen;
+    hi2c->TxCount = 0;
+    hi2c->pRxBuffer = rxData;
+    hi2c->RxSize = rxLen;
+    hi2c->RxCount = 0;
+    hi2c->State = (txLen > 0 || rxLen == 0) ? I2C_STATE_BUSY_TX : I2C_STATE_BUSY_RX;
+
+    hi2c->Instance->CR1.b.POS = 0;
+}
+
+/* 배치에 남은 트랜잭션이 있는지 확인하는 내부 함수 */
+static uint8_t I2C_IT_HasNext(I2C_Handle *hi2c)
+{
+    return (hi2c->pBatch != NULL) && (hi2c->BatchIndex + 1U < hi2c->BatchSize);
+}
+
+/* 트랜잭션 종료 조건 생성 내부 함수 - 다음 트랜잭션이 있으면 정지 조건 대신 반복 시작 조건 */
+static void I2C_IT_EndCondition(I2C_Handle *hi2c)
+{
+    if (I2C_IT_HasNext(hi2c))
+    {
+        hi2c->Instance->CR1.b.START = 1;
+    }
+    else
+    {
+        I2C_Stop(hi2c->Instance);
+    }
+}
+
+/* 트랜잭션 완료 처리 내부 함수 - 배치의 다음 트랜잭션을 로드하거나 전체 전송 종료 */
+static void I2C_IT_TransferDone(I2C_Handle *hi2c)
+{
+    if (I2C_IT_HasNext(hi2c))
+    {
+        I2C_Transaction *next;
+
+        hi2c->pBatch[hi2c->BatchIndex].Status = I2C_OK;
+        next = &hi2c->pBatch[++hi2c->BatchIndex];
+
+        /* 반복 시작 조건은 이미 요청됨 - SB 이벤트에서 다음 슬레이브 주소 전송 */
+        I2C_IT_Load(hi2c, next->DevAddress, next->pTxBuffer, next->TxSize, next->pRxBuffer, next->RxSize);
+        return;
+    }
+
+    I2C_IT_Complete(hi2c, I2C_OK);
+}
+
+/* 인터럽트 전송 시작 내부 함수 */
+static I2C_Status I2C_IT_Start(I2C_Handle *hi2c, uint8_t slaveAddr, uint8_t *txData, uint16_t txLen, uint8_t *rxData, uint16_t rxLen)
+{
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+
+    if (hi2c->State != I2C_STATE_READY)
+    {
+        return I2C_BUSY;
+    }
+
+    hi2c->pBatch = NULL;
+    hi2c->BatchSize = 0;
+    hi2c->BatchIndex = 0;
+    hi2c->ErrorCode = I2C_OK;
+    I2C_IT_Load(hi2c, slaveAddr, txData, txLen, rxData, rxLen);
+
+    /* 이벤트 및 에러 인터럽트 활성화 후 시작 조건 생성 */
+    I2Cx->CR2.b.ITEVTEN = 1;
+    I2Cx->CR2.b.ITERREN = 1;
+    I2Cx->CR1.b.START = 1;
+
+    return I2C_OK;
+}
+
+/* ADDR 이벤트 처리 내부 함수 */
+static void I2C_IT_Address(I2C_Handle *hi2c)
+{
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+
+    if (hi2c->State == I2C_STATE_BUSY_TX)
+    {
+        /* ADDR 플래그 클리어 */
+        (void)I2Cx->SR2;
+
+        if (hi2c->TxSize == 0)
+        {
+            /* 주소만 전송하는 경우 바로 종료 */
+            I2C_IT_EndCondition(hi2c);
+            I2C_IT_TransferDone(hi2c);
+            return;
+        }
+
+        I2Cx->CR2.b.ITBUFEN = 1;
+        return;
+    }
+
+    /* 수신: 레퍼런스 매뉴얼의 N=1, N=2, N>2 시퀀스에 따라 ACK/POS 설정 후 ADDR 클리어 */
+    if (hi2c->RxSize == 1)
+    {
+        I2Cx->CR1.b.ACK = 0;
+        (void)I2Cx->SR2;
+        I2C_IT_EndCondition(hi2c);
+        I2Cx->CR2.b.ITBUFEN = 1;
+    }
+    else if (hi2c->RxSize == 2)
+    {
+        I2Cx->CR1.b.ACK = 0;
+        I2Cx->CR1.b.POS = 1;
+        (void)I2Cx->SR2;
+        I2Cx->CR2.b.ITBUFEN = 0;
+    }
+    else
+    {
+        I2Cx->CR1.b.ACK = 1;
+        (void)I2Cx->SR2;
+        /* 마지막 3바이트는 BTF 이벤트로 처리 */
+        I2Cx->CR2.b.ITBUFEN = (hi2c->RxSize > 3) ? 1 : 0;
+    }
+}
+
+/* 송신 이벤트(TXE/BTF) 처리 내부 함수 */
+static void I2C_IT_Transmit(I2C_Handle *hi2c)
+{
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+
+    if (I2Cx->SR1.b.TxE && I2Cx->CR2.b.ITBUFEN)
+    {
+        if (hi2c->TxCount < hi2c->TxSize)
+        {
+            I2Cx->DR = hi2c->pTxBuffer[hi2c->TxCount++];
+        }
+        if (hi2c->TxCount >= hi2c->TxSize)
+        {
+            /* 마지막 바이트 - BTF 이벤트로 종료 처리 */
+            I2Cx->CR2.b.ITBUFEN = 0;
+        }
+    }
+    else if (I2Cx->SR1.b.BTF)
+    {
+        if (hi2c->TxCount < hi2c->TxSize)
+        {
+            I2Cx->DR = hi2c->pTxBuffer[hi2c->TxCount++];
+        }
+        else if (hi2c->RxSize > 0)
+        {
+            /* 수신 단계로 전환 - 반복 시작 조건 생성 */
+            hi2c->State = I2C_STATE_BUSY_RX;
+            I2Cx->CR1.b.START = 1;
+        }
+        else
+        {
+            I2C_IT_EndCondition(hi2c);
+            I2C_IT_TransferDone(hi2c);
+        }
+    }
+}
+
+/* 수신 이벤트(RXNE/BTF) 처리 내부 함수 */
+static void I2C_IT_Receive(I2C_Handle *hi2c)
+{
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+    uint16_t remaining = hi2c->RxSize - hi2c->RxCount;
+
+    if (I2Cx->SR1.b.RxNE && I2Cx->CR2.b.ITBUFEN)
+    {
+        if (remaining > 3)
+        {
+            hi2c->pRxBuffer[hi2c->RxCount++] = I2Cx->DR;
+            if (hi2c->RxSize - hi2c->RxCount == 3)
+            {
+                /* 남은 3바이트는 BTF 이벤트로 처리 */
+                I2Cx->CR2.b.ITBUFEN = 0;
+            }
+        }
+        else if (remaining == 1)
+        {
+            /* N=1: 정지(또는 반복 시작) 조건은 ADDR 단계에서 이미 요청됨 */
+            hi2c->pRxBuffer[hi2c->RxCount++] = I2Cx->DR;
+            I2C_IT_TransferDone(hi2c);
+        }
+    }
+    else if (I2Cx->SR1.b.BTF)
+    {
+        if (remaining == 3)
+        {
+            /* DR에 N-2, 시프트 레지스터에 N-1 - 마지막 바이트에 NACK 예약 */
+            I2Cx->CR1.b.ACK = 0;
+            hi2c->pRxBuffer[hi2c->RxCount++] = I2Cx->DR;
+        }
+        else if (remaining == 2)
+        {
+            /* DR에 N-1, 시프트 레지스터에 N - 종료 조건 후 두 바이트 읽기 */
+            I2C_IT_EndCondition(hi2c);
+            hi2c->pRxBuffer[hi2c->RxCount++] = I2Cx->DR;
+            hi2c->pRxBuffer[hi2c->RxCount++] = I2Cx->DR;
+            I2C_IT_TransferDone(hi2c);
+        }
+    }
+}
+
+/* 슬레이브 쓰기 완료 통지 내부 함수 */
+static void I2C_IT_SlaveFlushWrite(I2C_Handle *hi2c)
+{
+    if (hi2c->SlaveWriteCount > 0 && hi2c->SlaveWriteCallback != NULL)
+    {
+        hi2c->SlaveWriteCallback(hi2c, hi2c->SlaveWriteStart, hi2c->SlaveWriteCount);
+    }
+    hi2c->SlaveWriteCount = 0;
+}
+
+/* 슬레이브 레지스터 맵 이벤트 처리 내부 함수 */
+static void I2C_IT_Slave(I2C_Handle *hi2c)
+{
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+    I2C_RegMap *map;
+
+    /* 주소 일치 - SR2 읽기로 ADDR 클리어, DUALF로 OAR1/OAR2 구분 */
+    if (I2Cx->SR1.b.ADDR)
+    {
+        I2C_SR2_TypeDef sr2;
+        sr2.w = I2Cx->SR2.w;
+
+        I2C_IT_SlaveFlushWrite(hi2c);
+        hi2c->RegMapIndex = sr2.b.DUALF;
+        hi2c->SlavePreloaded = 0;
+        map = hi2c->pRegMap[hi2c->RegMapIndex];
+
+        if (!sr2.b.TRA)
+        {
+            /* 마스터 쓰기 - 첫 바이트(들)는 레지스터 포인터 */
+            hi2c->PointerBytes = (map != NULL) ? map->PointerSize : 0;
+            hi2c->RegPointer = (hi2c->PointerBytes > 0) ? 0 : hi2c->RegPointer;
+        }
+        return;
+    }
+
+    map = hi2c->pRegMap[hi2c->RegMapIndex];
+
+    /* 마스터 쓰기 데이터 수신 */
+    if (I2Cx->SR1.b.RxNE)
+    {
+        uint8_t data = I2Cx->DR;
+
+        if (map == NULL)
+        {
+            return;
+        }
+
+        if (hi2c->PointerBytes > 0)
+        {
+            hi2c->RegPointer = (uint16_t)((hi2c->RegPointer << 8) | data);
+            if (--hi2c->PointerBytes == 0)
+            {
+                hi2c->RegPointer %= map->Size;
+            }
+            return;
+        }
+
+        if (!map->ReadOnly)
+        {
+            if (hi2c->SlaveWriteCount == 0)
+            {
+                hi2c->SlaveWriteStart = hi2c->RegPointer;
+            }
+            map->pData[hi2c->RegPointer] = data;
+            hi2c->SlaveWriteCount++;
+        }
+        hi2c->RegPointer = (hi2c->RegPointer + 1) % map->Size;
+        return;
+    }
+
+    /* 마스터 읽기 - 애플리케이션 메모리에서 직접 전송 */
+    if (I2Cx->SR1.b.TxE)
+    {
+        if (map == NULL)
+        {
+            I2Cx->DR = 0xFF;
+            return;
+        }
+
+        I2Cx->DR = map->pData[hi2c->RegPointer];
+        hi2c->RegPointer = (hi2c->RegPointer + 1) % map->Size;
+        hi2c->SlavePreloaded = 1;
+        return;
+    }
+
+    /* 정지 조건 감지 - SR1 읽기 후 CR1 쓰기로 STOPF 클리어 */
+    if (I2Cx->SR1.b.STOPF)
+    {
+        I2Cx->CR1.w = I2Cx->CR1.w;
+        I2C_IT_SlaveFlushWrite(hi2c);
+    }
+}
+
+/* I2C 핸들 초기화 */
+I2C_Status I2C_InitHandle(I2C_Handle *hi2c)
+{
+    /* 널 포인터 체크 */
+    assert(hi2c != NULL);
+    assert(hi2c->Instance != NULL);
+
+    I2C_Init(hi2c->Instance, &hi2c->Config);
+
+    hi2c->TxCount = 0;
+    hi2c->RxCount = 0;
+    hi2c->pBatch = NULL;
+    hi2c->BatchSize = 0;
+    hi2c->BatchIndex = 0;
+    hi2c->ErrorCode = I2C_OK;
+    hi2c->State = I2C_STATE_READY;
+
+    return I2C_OK;
+}
+
+/* 인터럽트 모드 송신 시작 */
+I2C_Status I2C_WriteData_IT(I2C_Handle *hi2c, uint8_t slaveAddr, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(hi2c != NULL);
+    assert(hi2c->Instance != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return I2C_IT_Start(hi2c, slaveAddr, data, len, NULL, 0);
+}
+
+/* 인터럽트 모드 수신 시작 */
+I2C_Status I2C_ReadData_IT(I2C_Handle *hi2c, uint8_t slaveAddr, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(hi2c != NULL);
+    assert(hi2c->Instance != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return I2C_IT_Start(hi2c, slaveAddr, NULL, 0, data, len);
+}
+
+/* 인터럽트 모드 쓰기 후 읽기 시작 */
+I2C_Status I2C_WriteReadData_IT(I2C_Handle *hi2c, uint8_t slaveAddr, uint8_t *txData, uint16_t txLen, uint8_t *rxData, uint16_t rxLen)
+{
+    /* 널 포인터 체크 */
+    assert(hi2c != NULL);
+    assert(hi2c->Instance != NULL);
+    assert(txData != NULL);
+    assert(rxData != NULL);
+    /* 데이터 길이 체크 */
+    assert(txLen > 0);
+    assert(rxLen > 0);
+
+    return I2C_IT_Start(hi2c, slaveAddr, txData, txLen, rxData, rxLen);
+}
+
+/* 트랜잭션 배치 전송 시작 */
+I2C_Status I2C_SubmitBatch_IT(I2C_Handle *hi2c, I2C_Transaction *list, uint16_t count)
+{
+    /* 널 포인터 체크 */
+    assert(hi2c != NULL);
+    assert(hi2c->Instance != NULL);
+    assert(list != NULL);
+    /* 트랜잭션 수 체크 */
+    assert(count > 0);
+
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+
+    if (hi2c->State != I2C_STATE_READY)
+    {
+        return I2C_BUSY;
+    }
+
+    /* 모든 트랜잭션을 대기 상태로 표시 */
+    for (uint16_t i = 0; i < count; i++)
+    {
+        list[i].Status = I2C_BUSY;
+    }
+
+    hi2c->pBatch = list;
+    hi2c->BatchSize = count;
+    hi2c->BatchIndex = 0;
+    hi2c->ErrorCode = I2C_OK;
+    I2C_IT_Load(hi2c, list[0].DevAddress, list[0].pTxBuffer, list[0].TxSize, list[0].pRxBuffer, list[0].RxSize);
+
+    /* 이벤트 및 에러 인터럽트 활성화 후 시작 조건 생성 */
+    I2Cx->CR2.b.ITEVTEN = 1;
+    I2Cx->CR2.b.ITERREN = 1;
+    I2Cx->CR1.b.START = 1;
+
+    return I2C_OK;
+}
+
+/* 슬레이브 레지스터 맵 모드 시작 */
+I2C_Status I2C_Slave_StartRegMap_IT(I2C_Handle *hi2c, I2C_RegMap *map, I2C_RegMap *map2)
+{
+    /* 널 포인터 체크 */
+    assert(hi2c != NULL);
+    assert(hi2c->Instance != NULL);
+    assert(map != NULL);
+    assert(map->pData != NULL);
+    /* 레지스터 맵 크기 체크 */
+    assert(map->Size > 0);
+
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+
+    if (hi2c->State != I2C_STATE_READY)
+    {
+        return I2C_BUSY;
+    }
+
+    hi2c->pRegMap[0] = map;
+    hi2c->pRegMap[1] = (map2 != NULL) ? map2 : map;
+    hi2c->RegMapIndex = 0;
+    hi2c->RegPointer = 0;
+    hi2c->PointerBytes = 0;
+    hi2c->SlavePreloaded = 0;
+    hi2c->SlaveWriteCount = 0;
+    hi2c->State = I2C_STATE_LISTEN;
+
+    /* 주소 일치 시 ACK, 이벤트/버퍼/에러 인터럽트 활성화 */
+    I2Cx->CR1.b.ACK = 1;
+    I2Cx->CR2.b.ITEVTEN = 1;
+    I2Cx->CR2.b.ITBUFEN = 1;
+    I2Cx->CR2.b.ITERREN = 1;
 
     return I2C_OK;
-}
\ No newline at end of file
+}
+
+/* 슬레이브 레지스터 맵 모드 종료 */
+void I2C_Slave_Stop(I2C_Handle *hi2c)
+{
+    /* 널 포인터 체크 */
+    assert(hi2c != NULL);
+    assert(hi2c->Instance != NULL);
+
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+
+    if (hi2c->State != I2C_STATE_LISTEN)
+    {
+        return;
+    }
+
+    I2Cx->CR2.b.ITEVTEN = 0;
+    I2Cx->CR2.b.ITBUFEN = 0;
+    I2Cx->CR2.b.ITERREN = 0;
+    I2Cx->CR1.b.ACK = 0;
+
+    hi2c->State = I2C_STATE_READY;
+}
+
+/* I2C 이벤트 인터럽트 핸들러 */
+void I2C_EV_IRQHandler(I2C_Handle *hi2c)
+{
+    /* 널 포인터 체크 */
+    assert(hi2c != NULL);
+    assert(hi2c->Instance != NULL);
+
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+
+    if (hi2c->State == I2C_STATE_READY)
+    {
+        return;
+    }
+
+    /* 슬레이브 레지스터 맵 모드 */
+    if (hi2c->State == I2C_STATE_LISTEN)
+    {
+        I2C_IT_Slave(hi2c);
+        return;
+    }
+
+    /* 시작 조건 생성 완료 - 슬레이브 주소 전송 */
+    if (I2Cx->SR1.b.SB)
+    {
+        /* 1바이트 수신 직후의 반복 시작 조건: 주소를 쓰기 전에 남은 바이트를 먼저 읽음 */
+        if (hi2c->State == I2C_STATE_BUSY_RX && hi2c->RxCount < hi2c->RxSize && I2Cx->SR1.b.RxNE)
+        {
+            I2C_IT_Receive(hi2c);
+        }
+
+        if (hi2c->State == I2C_STATE_BUSY_TX)
+        {
+            I2Cx->DR = (hi2c->DevAddress << 1) & 0xFE;
+        }
+        else
+        {
+            I2Cx->DR = (hi2c->DevAddress << 1) | 0x01;
+        }
+        return;
+    }
+
+    /* 반복 시작 조건 요청 후 SB 전까지 남아 있는 이전 단계의 BTF/TXE는 무시 */
+    if (I2Cx->CR1.b.START)
+    {
+        return;
+    }
+
+    /* 주소 전송 완료 */
+    if (I2Cx->SR1.b.ADDR)
+    {
+        I2C_IT_Address(hi2c);
+        return;
+    }
+
+    if (hi2c->State == I2C_STATE_BUSY_TX)
+    {
+        I2C_IT_Transmit(hi2c);
+    }
+    else
+    {
+        I2C_IT_Receive(hi2c);
+    }
+}
+
+/* I2C 에러 인터럽트 핸들러 */
+void I2C_ER_IRQHandler(I2C_Handle *hi2c)
+{
+    /* 널 포인터 체크 */
+    assert(hi2c != NULL);
+    assert(hi2c->Instance != NULL);
+
+    I2C_TypeDef *I2Cx = hi2c->Instance;
+    I2C_Status status = I2C_ERROR;
+
+    /* 슬레이브 송신 종료 - 마스터의 NACK는 정상 종료 */
+    if (hi2c->State == I2C_STATE_LISTEN)
+    {
+        if (I2Cx->SR1.b.AF)
+        {
+            I2Cx->SR1.b.AF = 0;
+            /* 미리 적재한 바이트가 DR에 남아 있으면(TXE=0) 다음 읽기의 첫 바이트로 나가므로 포인터를 유지하고,
+               DR을 떠나 전송되지 못하고 버려진 경우(TXE=1)에만 포인터를 되돌림 */
+            if (hi2c->SlavePreloaded && I2Cx->SR1.b.TxE)
+            {
+                I2C_RegMap *map = hi2c->pRegMap[hi2c->RegMapIndex];
+                hi2c->RegPointer = (hi2c->RegPointer == 0) ? (map->Size - 1) : (hi2c->RegPointer - 1);
+            }
+            hi2c->SlavePreloaded = 0;
+        }
+        /* 버스 에러 및 오버런은 플래그만 클리어하고 대기 상태 유지 */
+        if (I2Cx->SR1.b.BERR)
+        {
+            I2Cx->SR1.b.BERR = 0;
+        }
+        if (I2Cx->SR1.b.OVR)
+        {
+            I2Cx->SR1.b.OVR = 0;
+        }
+        return;
+    }
+
+    /* 응답 실패 - 정지 조건으로 버스 해제 */
+    if (I2Cx->SR1.b.AF)
+    {
+        I2Cx->SR1.b.AF = 0;
+        I2C_Stop(I2Cx);
+    }
+
+    /* 버스 에러, 오버런 플래그 클리어 */
+    if (I2Cx->SR1.b.BERR)
+    {
+        I2Cx->SR1.b.BERR = 0;
+    }
+    if (I2Cx->SR1.b.OVR)
+    {
+        I2Cx->SR1.b.OVR = 0;
+    }
+
+    /* 중재 손실 - 인터럽트 문맥에서는 백오프하지 않고 상태만 보고 */
+    if (I2Cx->SR1.b.ARLO)
+    {
+        status = I2C_ArbitrationLost(I2Cx);
+    }
+
+    if (hi2c->State != I2C_STATE_READY)
+    {
+        I2C_IT_Complete(hi2c, status);
+    }
+}
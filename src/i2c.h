@@ -2,6 +2,8 @@
 #define __I2C_H
 
 #include "stm32f411xe.h"
+#include "dma.h"
+#include "gpio.h"
 
 /**
  * @brief I2C 통신 상태를 나타내는 열거형
@@ -11,9 +13,20 @@ typedef enum
     I2C_OK = 0, /*!< 정상 동작 완료 */
     I2C_ERROR,  /*!< 일반적인 오류 발생 */
     I2C_BUSY,   /*!< I2C 버스가 사용 중 */
-    I2C_TIMEOUT /*!< 타임아웃 발생 */
+    I2C_TIMEOUT,  /*!< 타임아웃 발생 */
+    I2C_PEC_ERROR,       /*!< SMBus PEC 불일치 (SR1.PECERR) */
+    I2C_ARBITRATION_LOST /*!< 다른 마스터에게 중재 손실 (SR1.ARLO) */
 } I2C_Status;
 
+/**
+ * @brief 슬레이브 내부 레지스터(메모리) 주소 크기
+ */
+typedef enum
+{
+    I2C_MEMADD_SIZE_8BIT = 1, /*!< 8비트 레지스터 주소 */
+    I2C_MEMADD_SIZE_16BIT     /*!< 16비트 레지스터 주소 (MSB 먼저 전송) */
+} I2C_MemAddSize;
+
 /**
  * @brief I2C 초기화를 위한 설정 구조체
  */
@@ -21,11 +34,113 @@ typedef struct
 {
     uint32_t ClockSpeed;   /*!< I2C 통신 속도 (Hz). 범위: 100KHz(표준모드) 또는 400KHz(고속모드) */
     uint8_t OwnAddress;    /*!< 자신의 슬레이브 주소 (7비트). 마스터 모드에서는 사용되지 않음 */
+    uint8_t OwnAddress2;   /*!< 두 번째 슬레이브 주소 (7비트, OAR2). 0: 듀얼 주소 사용 안 함 */
     uint8_t DutyCycle;     /*!< 고속 모드에서의 듀티 사이클. 0: 2:1, 1: 16:9 */
     uint8_t GeneralCall;   /*!< General Call 활성화 여부. 0: 비활성화, 1: 활성화 */
     uint8_t NoStretchMode; /*!< Clock Stretching 비활성화 여부. 0: 활성화(stretching 허용), 1: 비활성화 */
+    uint8_t SMBusMode;     /*!< SMBus 호스트 모드 여부. 0: I2C 모드, 1: SMBus 호스트 모드 */
+    uint8_t PECEnable;     /*!< 하드웨어 PEC 계산/검사 활성화 여부. 0: 비활성화, 1: 활성화 */
 } I2C_Config;
 
+/**
+ * @brief I2C DMA 전송 완료 콜백 함수 타입
+ * @param I2Cx: 전송을 완료한 I2C 주변장치
+ * @param status: 전송 결과 (I2C_OK 또는 오류 코드)
+ */
+typedef void (*I2C_DMACallback)(I2C_TypeDef *I2Cx, I2C_Status status);
+
+/**
+ * @brief I2C 핸들의 전송 상태를 나타내는 열거형
+ */
+typedef enum
+{
+    I2C_STATE_READY = 0, /*!< 전송 대기 상태 */
+    I2C_STATE_BUSY_TX,   /*!< 인터럽트 기반 송신 진행 중 */
+    I2C_STATE_BUSY_RX,   /*!< 인터럽트 기반 수신 진행 중 */
+    I2C_STATE_LISTEN     /*!< 슬레이브 레지스터 맵 모드로 주소 대기 중 */
+} I2C_State;
+
+/**
+ * @brief 슬레이브 레지스터 맵 구조체
+ * @note  마스터가 쓰는 첫 PointerSize 바이트는 레지스터 포인터로 해석되며, 이후 데이터는
+ *        포인터 위치부터 자동 증가하며 pData에 직접 기록/전송됩니다 (Size에서 0으로 순환).
+ */
+typedef struct
+{
+    uint8_t        *pData;       /*!< 레지스터 맵으로 노출할 애플리케이션 메모리 */
+    uint16_t        Size;        /*!< 레지스터 맵 크기 (바이트) */
+    I2C_MemAddSize  PointerSize; /*!< 레지스터 포인터 크기 (8비트 또는 16비트, 0: 포인터 없이 현재 위치부터) */
+    uint8_t         ReadOnly;    /*!< 1: 마스터의 쓰기 데이터를 무시 (포인터만 갱신) */
+} I2C_RegMap;
+
+/**
+ * @brief 중재 손실 재시도 정책 구조체
+ * @note  n번째 재시도 전 백오프는 [MinBackoffUs, min(MinBackoffUs + MinBackoffUs * 2^n, MaxBackoffUs)] 구간의 난수입니다.
+ */
+typedef struct
+{
+    uint8_t  MaxRetries;   /*!< 최대 재시도 횟수. 0: 재시도 안 함 */
+    uint16_t MinBackoffUs; /*!< 최소 백오프 시간 (us) */
+    uint16_t MaxBackoffUs; /*!< 최대 백오프 시간 (us) */
+} I2C_RetryPolicy;
+
+/**
+ * @brief I2C 통신 통계 구조체
+ */
+typedef struct
+{
+    uint32_t ArbitrationLost; /*!< 중재 손실 횟수 (블로킹/인터럽트 전송 모두 포함) */
+    uint32_t Retries;         /*!< 중재 손실 후 재시도 횟수 */
+    uint32_t RetryExhausted;  /*!< 재시도 횟수를 모두 소진하여 실패한 횟수 */
+} I2C_Stats;
+
+/**
+ * @brief I2C 트랜잭션 디스크립터 (배치 전송용)
+ * @note  TxSize와 RxSize가 모두 0이 아니면 쓰기 후 반복 시작 조건으로 읽기를 수행합니다.
+ */
+typedef struct
+{
+    uint8_t     DevAddress; /*!< 대상 슬레이브의 7비트 주소 */
+    uint8_t    *pTxBuffer;  /*!< 쓰기 단계 데이터 버퍼 (TxSize가 0이면 NULL 허용) */
+    uint16_t    TxSize;     /*!< 쓰기 단계 데이터 크기 */
+    uint8_t    *pRxBuffer;  /*!< 읽기 단계 데이터 버퍼 (RxSize가 0이면 NULL 허용) */
+    uint16_t    RxSize;     /*!< 읽기 단계 데이터 크기 */
+    I2C_Status  Status;     /*!< 트랜잭션 결과 (드라이버가 기록, 실행되지 않은 항목은 I2C_BUSY) */
+    const I2C_RetryPolicy *pRetry; /*!< 중재 손실 재시도 정책 (I2C_Transfer 전용, NULL: 인스턴스 기본 정책) */
+} I2C_Transaction;
+
+/**
+ * @brief I2C 핸들 구조체
+ */
+typedef struct __I2C_Handle
+{
+    I2C_TypeDef *Instance;          /*!< I2C 레지스터 베이스 주소 */
+    I2C_Config   Config;            /*!< I2C 설정 */
+    uint8_t      DevAddress;        /*!< 대상 슬레이브의 7비트 주소 */
+    uint8_t     *pTxBuffer;         /*!< 송신 버퍼 포인터 */
+    uint16_t     TxSize;            /*!< 송신 데이터 크기 */
+    uint16_t     TxCount;           /*!< 송신된 데이터 수 */
+    uint8_t     *pRxBuffer;         /*!< 수신 버퍼 포인터 */
+    uint16_t     RxSize;            /*!< 수신 데이터 크기 */
+    uint16_t     RxCount;           /*!< 수신된 데이터 수 */
+    I2C_Transaction *pBatch;        /*!< 진행 중인 트랜잭션 배치 (단일 전송이면 NULL) */
+    uint16_t     BatchSize;         /*!< 배치의 트랜잭션 수 */
+    uint16_t     BatchIndex;        /*!< 현재 진행 중인 트랜잭션 인덱스 */
+    I2C_RegMap  *pRegMap[2];        /*!< 슬레이브 레지스터 맵 (0: OAR1, 1: OAR2) */
+    uint8_t      RegMapIndex;       /*!< 현재 트랜잭션의 레지스터 맵 인덱스 */
+    uint8_t      PointerBytes;      /*!< 수신 대기 중인 레지스터 포인터 바이트 수 */
+    uint8_t      SlavePreloaded;    /*!< 슬레이브 송신 시 DR에 미리 적재된 바이트 존재 여부 */
+    uint16_t     RegPointer;        /*!< 슬레이브 레지스터 포인터 */
+    uint16_t     SlaveWriteStart;   /*!< 마스터 쓰기 시작 위치 */
+    uint16_t     SlaveWriteCount;   /*!< 마스터가 쓴 바이트 수 */
+    volatile I2C_State  State;      /*!< 전송 상태 */
+    volatile I2C_Status ErrorCode;  /*!< 마지막 전송 결과 */
+    void        *pContext;          /*!< 상위 계층 컨텍스트 (드라이버는 사용하지 않음, 콜백에서 참조) */
+    void (*XferCpltCallback)(struct __I2C_Handle *hi2c); /*!< 전송 완료 콜백 (NULL 허용) */
+    void (*ErrorCallback)(struct __I2C_Handle *hi2c);    /*!< 전송 오류 콜백 (NULL 허용) */
+    void (*SlaveWriteCallback)(struct __I2C_Handle *hi2c, uint16_t start, uint16_t len); /*!< 마스터 쓰기 종료 콜백 (NULL 허용) */
+} I2C_Handle;
+
 /**
  * @brief  I2C 주변장치를 초기화합니다.
  * @param  I2Cx: 초기화할 I2C 주변장치 (I2C1 또는 I2C2)
@@ -47,11 +162,50 @@ void I2C_Init(I2C_TypeDef *I2Cx, I2C_Config *config);
  */
 void I2C_DeInit(I2C_TypeDef *I2Cx);
 
+/**
+ * @brief  버스 복구에 사용할 SCL/SDA 핀을 등록합니다.
+ * @param  I2Cx: 대상 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  GPIOx: SCL/SDA 핀이 속한 GPIO 포트 (NULL이면 복구 비활성화)
+ * @param  sclPin: SCL 핀 번호 (0-15)
+ * @param  sdaPin: SDA 핀 번호 (0-15)
+ * @param  af: 복구 후 복원할 I2C 대체 기능 번호 (예: GPIO_AF4)
+ * @return None
+ * @note   핀 등록만으로는 자동 복구가 켜지지 않습니다. 자동 복구는 I2C_SetAutoRecovery()로 설정합니다.
+ * @warning SCL과 SDA는 같은 GPIO 포트에 있어야 합니다.
+ */
+void I2C_SetRecoveryPins(I2C_TypeDef *I2Cx, GPIO_TypeDef *GPIOx, uint8_t sclPin, uint8_t sdaPin, GPIO_AlternateFunction af);
+
+/**
+ * @brief  I2C_Start()에서 버스 고착을 감지했을 때 자동으로 복구할지 설정합니다.
+ * @param  I2Cx: 대상 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  enable: 1이면 자동 복구, 0이면 I2C_BUSY 반환 (기본값 0)
+ * @return None
+ * @note   고착은 래치된 버스 에러(BERR) 또는 SCL이 High인 동안 SDA가 계속 Low인 상태로 판단하므로
+ *         I2C_SetRecoveryPins()로 핀이 등록되어 있어야 합니다.
+ * @warning 멀티 마스터 버스에서는 다른 마스터의 전송을 끊지 않도록 신중하게 사용하십시오.
+ */
+void I2C_SetAutoRecovery(I2C_TypeDef *I2Cx, uint8_t enable);
+
+/**
+ * @brief  슬레이브가 SDA를 Low로 붙잡고 있는 고착 상태에서 버스를 복구합니다.
+ * @param  I2Cx: 복구할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @return I2C_Status: 복구 결과 (I2C_OK: 버스 해제됨, I2C_BUSY: 여전히 사용 중, I2C_ERROR: 핀 미등록)
+ * @note   핀을 GPIO로 전환해 SDA가 해제될 때까지 최대 9개의 SCL 펄스와 정지 조건을 생성한 뒤,
+ *         CR1.SWRST로 주변장치를 리셋하고 마지막 I2C_Init()의 설정으로 재초기화합니다.
+ * @warning
+ *         - I2C_SetRecoveryPins()로 핀을 먼저 등록해야 합니다.
+ *         - 인터럽트/DMA 전송이 진행 중이면 호출하지 마십시오. 오류 콜백에서 호출할 수 있습니다.
+ */
+I2C_Status I2C_RecoverBus(I2C_TypeDef *I2Cx);
+
 /**
  * @brief  I2C 통신의 시작 조건을 생성합니다.
  * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
  * @return I2C_Status: 시작 조건 생성 결과
  * @note   이 함수는 버스가 유휴 상태일 때만 호출해야 합니다.
+ * @remark 마스터가 아닌 상태에서는 버스가 해제될 때까지 기다리며, 타임아웃 동안 BUSY가 유지되면
+ *         I2C_BUSY를 반환합니다. 래치된 중재 손실은 I2C_ARBITRATION_LOST로 보고합니다.
+ *         자동 복구가 켜져 있고 버스가 실제로 고착된 경우에만 I2C_RecoverBus()를 먼저 호출합니다.
  * @warning 시작 조건 생성 후에는 반드시 주소 또는 데이터를 전송해야 합니다.
  */
 I2C_Status I2C_Start(I2C_TypeDef *I2Cx);
@@ -93,6 +247,8 @@ I2C_Status I2C_ReadByte(I2C_TypeDef *I2Cx, uint8_t *data, uint8_t ack);
  * @param  len: 전송할 데이터의 길이 (바이트)
  * @return I2C_Status: 데이터 전송 결과
  * @note   이 함수는 시작 조건 생성부터 정지 조건 생성까지 전체 전송 과정을 처리합니다.
+ * @remark TXE마다 DR을 채우고 BTF는 정지 조건 직전에 한 번만 확인하므로 바이트 사이에
+ *         유휴 구간이 생기지 않습니다.
  * @warning
  *         - data 버퍼는 최소 len 바이트의 크기를 가져야 합니다.
  *         - 전송 도중 슬레이브가 응답하지 않으면 I2C_ERROR를 반환합니다.
@@ -111,9 +267,320 @@ I2C_Status I2C_WriteData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, ui
  *         - data 버퍼는 최소 len 바이트의 크기를 가져야 합니다.
  *         - 수신 도중 슬레이브가 응답하지 않으면 I2C_ERROR를 반환합니다.
  *         - 마지막 바이트 수신 시 자동으로 NACK를 전송합니다.
+ * @remark 레퍼런스 매뉴얼의 N=1, N=2(POS), N>2(BTF로 마지막 바이트 2개 일괄 처리) 수신
+ *         시퀀스를 따르므로 NACK/STOP 타이밍이 CPU 응답 속도에 의존하지 않습니다.
  */
 I2C_Status I2C_ReadData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len);
 
+/**
+ * @brief  반복 시작 조건을 사용하여 데이터를 전송한 뒤 이어서 수신합니다.
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  txData: 전송할 데이터 버퍼의 포인터
+ * @param  txLen: 전송할 데이터의 길이 (바이트)
+ * @param  rxData: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  rxLen: 수신할 데이터의 길이 (바이트)
+ * @return I2C_Status: 송수신 결과
+ * @note   쓰기 단계와 읽기 단계 사이에 정지 조건 대신 반복 시작 조건(Sr)을 생성하므로
+ *         트랜잭션 전체가 끝날 때까지 다른 마스터가 버스를 점유할 수 없습니다.
+ * @warning
+ *         - txData/rxData 버퍼는 각각 최소 txLen/rxLen 바이트의 크기를 가져야 합니다.
+ *         - 슬레이브가 주소에 응답하지 않으면 I2C_ERROR를 반환합니다.
+ */
+I2C_Status I2C_WriteReadData(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *txData, uint16_t txLen, uint8_t *rxData, uint16_t rxLen);
+
+/**
+ * @brief  슬레이브의 내부 레지스터(메모리)에 데이터를 씁니다.
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  memAddr: 시작 레지스터 주소
+ * @param  memAddSize: 레지스터 주소 크기 (I2C_MEMADD_SIZE_8BIT 또는 I2C_MEMADD_SIZE_16BIT)
+ * @param  data: 전송할 데이터 버퍼의 포인터
+ * @param  len: 전송할 데이터의 길이 (바이트)
+ * @return I2C_Status: 데이터 전송 결과
+ * @note   레지스터 주소와 데이터를 하나의 트랜잭션으로 전송하므로 호출자가
+ *         주소를 데이터 앞에 붙인 버퍼를 따로 만들 필요가 없습니다.
+ */
+I2C_Status I2C_MemWrite(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint16_t memAddr, I2C_MemAddSize memAddSize, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  슬레이브의 내부 레지스터(메모리)에서 데이터를 읽습니다.
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  memAddr: 시작 레지스터 주소
+ * @param  memAddSize: 레지스터 주소 크기 (I2C_MEMADD_SIZE_8BIT 또는 I2C_MEMADD_SIZE_16BIT)
+ * @param  data: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 수신할 데이터의 길이 (바이트)
+ * @return I2C_Status: 데이터 수신 결과
+ * @note   레지스터 주소 전송 후 반복 시작 조건으로 읽기 단계를 이어갑니다 (I2C_WriteReadData 사용).
+ */
+I2C_Status I2C_MemRead(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint16_t memAddr, I2C_MemAddSize memAddSize, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  하나의 트랜잭션(쓰기, 읽기, 또는 쓰기 후 반복 시작 읽기)을 블로킹 방식으로 실행합니다.
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  xfer: 실행할 트랜잭션 (결과는 xfer->Status에도 기록)
+ * @return I2C_Status: 트랜잭션 결과 (재시도를 모두 소진하면 I2C_ARBITRATION_LOST)
+ * @note   다른 마스터에게 중재를 잃으면 xfer->pRetry(NULL이면 인스턴스 기본 정책)에 따라
+ *         무작위 백오프 후 재시도합니다. I2C_WriteData, I2C_ReadData, I2C_WriteReadData도 이 함수를 사용합니다.
+ */
+I2C_Status I2C_Transfer(I2C_TypeDef *I2Cx, I2C_Transaction *xfer);
+
+/**
+ * @brief  인스턴스의 기본 중재 손실 재시도 정책을 설정합니다.
+ * @param  I2Cx: 대상 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  policy: 재시도 정책 (기본값: 3회, 20-500us)
+ * @return None
+ * @note   블로킹 전송 함수에 적용됩니다. 인터럽트/DMA 전송은 재시도하지 않고 I2C_ARBITRATION_LOST를 보고합니다.
+ */
+void I2C_SetRetryPolicy(I2C_TypeDef *I2Cx, const I2C_RetryPolicy *policy);
+
+/**
+ * @brief  인스턴스의 통신 통계를 조회합니다.
+ * @param  I2Cx: 대상 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  stats: 통계를 복사할 구조체 포인터
+ * @return None
+ */
+void I2C_GetStats(I2C_TypeDef *I2Cx, I2C_Stats *stats);
+
+/**
+ * @brief  인스턴스의 통신 통계를 초기화합니다.
+ * @param  I2Cx: 대상 I2C 주변장치 (I2C1 또는 I2C2)
+ * @return None
+ */
+void I2C_ResetStats(I2C_TypeDef *I2Cx);
+
+/**
+ * @brief  주소만 전송하여 장치가 응답(ACK)하는지 확인합니다.
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  trials: 최대 시도 횟수
+ * @return I2C_Status: 확인 결과
+ *         - I2C_OK: 장치가 주소에 ACK로 응답
+ *         - I2C_BUSY: 모든 시도에서 NACK (EEPROM 쓰기 사이클 진행 중 등)
+ * @note   EEPROM 쓰기 사이클 완료 감지(ACK 폴링)에 사용합니다. 각 시도는 시작 조건, 주소(쓰기), 정지 조건으로 구성됩니다.
+ */
+I2C_Status I2C_IsDeviceReady(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint32_t trials);
+
+/**
+ * @brief 전체 스캔 시 주소 범위 (예약 주소 0x00-0x07, 0x78-0x7F 제외)
+ */
+#define I2C_SCAN_FIRST_ADDRESS 0x08
+#define I2C_SCAN_LAST_ADDRESS  0x77
+
+/**
+ * @brief 스캔 비트맵에서 주소의 응답 여부를 확인합니다.
+ */
+#define I2C_SCAN_IS_PRESENT(bitmap, addr) (((bitmap)[(addr) >> 3] >> ((addr) & 0x07)) & 0x01)
+
+/**
+ * @brief  버스의 장치를 주소만 전송하여 검색합니다.
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  candidates: 검사할 7비트 주소 목록 (NULL이면 0x08-0x77 전체)
+ * @param  count: candidates의 주소 수 (candidates가 NULL이면 무시)
+ * @param  bitmap: 응답한 주소를 기록할 128비트 비트맵 (16바이트, 비트 n = 주소 n)
+ * @return I2C_Status: 스캔 결과 (중재 손실 등 버스 오류 시 중단하고 해당 상태 반환)
+ * @note   각 주소는 시작 조건, 주소(쓰기), 정지 조건만으로 검사하며 NACK(AF)는 즉시 감지됩니다.
+ *         응답도 NACK도 없는 주소는 기본 타임아웃 대신 짧은 타임아웃 후 다음 주소로 넘어갑니다.
+ * @warning 주소만 쓰는 검사에 부작용이 있는 장치가 있다면 candidates로 대상을 제한하십시오.
+ */
+I2C_Status I2C_Scan(I2C_TypeDef *I2Cx, const uint8_t *candidates, uint8_t count, uint8_t *bitmap);
+
+/**
+ * @brief  SMBus 블록 쓰기를 수행합니다 (커맨드, 바이트 수, 데이터[, PEC]).
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  command: SMBus 커맨드 코드
+ * @param  data: 전송할 데이터 버퍼의 포인터
+ * @param  len: 전송할 데이터의 길이 (바이트, 1-255)
+ * @return I2C_Status: 데이터 전송 결과
+ * @note   PECEnable이 설정되어 있으면 마지막 데이터 바이트 이후 CR1.PEC를 설정하여
+ *         주변장치가 계산한 PEC 바이트를 자동으로 전송합니다.
+ */
+I2C_Status I2C_SMBus_BlockWrite(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t command, uint8_t *data, uint8_t len);
+
+/**
+ * @brief  SMBus 블록 읽기를 수행합니다 (커맨드 전송 후 반복 시작, 바이트 수, 데이터[, PEC]).
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  command: SMBus 커맨드 코드
+ * @param  data: 수신한 데이터를 저장할 버퍼의 포인터 (바이트 수 필드는 제외)
+ * @param  len: 입력 시 버퍼 크기, 출력 시 수신한 데이터 길이
+ * @return I2C_Status: 데이터 수신 결과
+ *         - I2C_ERROR: 슬레이브가 보낸 바이트 수가 0이거나 버퍼 크기보다 큼
+ *         - I2C_PEC_ERROR: 수신한 PEC가 하드웨어 계산값과 다름
+ * @note   PECEnable이 설정되어 있으면 주변장치가 PEC를 검사하며 불일치 시 마지막 바이트를 NACK합니다.
+ *         소프트웨어 CRC-8 계산이 필요하지 않습니다.
+ */
+I2C_Status I2C_SMBus_BlockRead(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t command, uint8_t *data, uint8_t *len);
+
+/**
+ * @brief  DMA를 사용하여 I2C로 여러 바이트의 데이터를 전송합니다.
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  data: 전송할 데이터 버퍼의 포인터
+ * @param  len: 전송할 데이터의 길이 (바이트)
+ * @param  callback: 전송 완료 시 호출될 콜백 함수 (NULL 허용)
+ * @return I2C_Status: 전송 시작 결과
+ * @note   시작 조건과 주소 전송까지만 대기하고 즉시 반환합니다. 데이터 바이트는
+ *         DMA1 스트림(I2C1: Stream 6, I2C2: Stream 7)이 TXE 요청에 맞춰 DR에 기록합니다.
+ * @warning
+ *         - 전송이 완료될 때까지 data 버퍼는 유효해야 합니다.
+ *         - 해당 DMA 스트림과 I2Cx 이벤트/에러 인터럽트 핸들러에서 I2C_DMA_IRQHandler()를 호출해야 합니다.
+ *         - 이전 DMA 전송이 진행 중이면 I2C_BUSY를 반환합니다.
+ */
+I2C_Status I2C_WriteData_DMA(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len, I2C_DMACallback callback);
+
+/**
+ * @brief  DMA를 사용하여 I2C로 여러 바이트의 데이터를 수신합니다.
+ * @param  I2Cx: 사용할 I2C 주변장치 (I2C1 또는 I2C2)
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  data: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 수신할 데이터의 길이 (바이트)
+ * @param  callback: 수신 완료 시 호출될 콜백 함수 (NULL 허용)
+ * @return I2C_Status: 수신 시작 결과
+ * @note   CR2.LAST를 설정하므로 DMA의 마지막 전송 직후 하드웨어가 자동으로 NACK를 보냅니다.
+ *         DMA1 스트림(I2C1: Stream 0, I2C2: Stream 2)을 사용합니다.
+ * @warning
+ *         - 수신이 완료될 때까지 data 버퍼는 유효해야 합니다.
+ *         - 해당 DMA 스트림과 I2Cx 이벤트/에러 인터럽트 핸들러에서 I2C_DMA_IRQHandler()를 호출해야 합니다.
+ *         - 이전 DMA 전송이 진행 중이면 I2C_BUSY를 반환합니다.
+ */
+I2C_Status I2C_ReadData_DMA(I2C_TypeDef *I2Cx, uint8_t slaveAddr, uint8_t *data, uint16_t len, I2C_DMACallback callback);
+
+/**
+ * @brief  I2C DMA 인터럽트 핸들러입니다.
+ * @param  I2Cx: DMA 전송을 진행 중인 I2C 주변장치 (I2C1 또는 I2C2)
+ * @return None
+ * @note   DMA 스트림 인터럽트와 I2Cx 이벤트(EV)/에러(ER) 인터럽트에서 모두 호출합니다.
+ *         DMA 전송 완료 시 정지 조건을 생성하고, DMA 요청을 비활성화한 뒤 콜백을 호출합니다.
+ *         데이터 단계의 NACK(AF)과 버스 에러(BERR)는 I2C_ERROR, 중재 손실(ARLO)은
+ *         I2C_ARBITRATION_LOST로 전송을 중단하고 콜백에 전달합니다.
+ * @remark 송신의 경우 DMA 완료 후 이벤트 인터럽트로 마지막 바이트의 BTF를 받아 정지 조건을 생성합니다
+ *         (ISR 안에서 대기하지 않음).
+ * @warning DMA 전송 중에는 같은 인스턴스에서 I2C_EV_IRQHandler()/I2C_ER_IRQHandler()를 함께 사용하지 않습니다.
+ */
+void I2C_DMA_IRQHandler(I2C_TypeDef *I2Cx);
+
+/**
+ * @brief  진행 중인 I2C DMA 전송을 중단합니다.
+ * @param  I2Cx: DMA 전송을 진행 중인 I2C 주변장치 (I2C1 또는 I2C2)
+ * @return None
+ * @note   DMA 스트림과 DMA 요청, 이벤트/에러 인터럽트를 끄고, 마스터 상태이면 정지 조건을 생성합니다.
+ *         콜백은 호출하지 않습니다. DMA 전송 중이 아니면 아무 동작도 하지 않습니다.
+ */
+void I2C_AbortDMA(I2C_TypeDef *I2Cx);
+
+/**
+ * @brief  I2C 핸들을 초기화합니다.
+ * @param  hi2c: I2C 핸들 구조체 포인터
+ * @return I2C_Status: 초기화 결과
+ * @note   hi2c->Config로 I2C_Init()을 호출하고 핸들 상태를 I2C_STATE_READY로 설정합니다.
+ *         콜백 포인터는 변경하지 않습니다.
+ */
+I2C_Status I2C_InitHandle(I2C_Handle *hi2c);
+
+/**
+ * @brief  인터럽트 모드로 I2C 송신을 시작합니다.
+ * @param  hi2c: I2C 핸들 구조체 포인터
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  data: 전송할 데이터 버퍼의 포인터
+ * @param  len: 전송할 데이터의 길이 (바이트)
+ * @return I2C_Status: 송신 시작 결과
+ * @note   시작 조건만 요청하고 즉시 반환합니다. SB→ADDR→TXE→BTF→STOP 과정은
+ *         I2C_EV_IRQHandler()에서 진행되며, 완료 시 XferCpltCallback이 호출됩니다.
+ * @warning
+ *         - 전송이 완료될 때까지 data 버퍼는 유효해야 합니다.
+ *         - 이전 전송이 진행 중이면 I2C_BUSY를 반환합니다.
+ */
+I2C_Status I2C_WriteData_IT(I2C_Handle *hi2c, uint8_t slaveAddr, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  인터럽트 모드로 I2C 수신을 시작합니다.
+ * @param  hi2c: I2C 핸들 구조체 포인터
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  data: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 수신할 데이터의 길이 (바이트)
+ * @return I2C_Status: 수신 시작 결과
+ * @note   시작 조건만 요청하고 즉시 반환합니다. 수신 완료 시 XferCpltCallback이 호출됩니다.
+ * @warning
+ *         - 수신이 완료될 때까지 data 버퍼는 유효해야 합니다.
+ *         - 이전 전송이 진행 중이면 I2C_BUSY를 반환합니다.
+ */
+I2C_Status I2C_ReadData_IT(I2C_Handle *hi2c, uint8_t slaveAddr, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  인터럽트 모드로 반복 시작 조건을 사용한 쓰기 후 읽기를 시작합니다.
+ * @param  hi2c: I2C 핸들 구조체 포인터
+ * @param  slaveAddr: 대상 슬레이브의 7비트 주소
+ * @param  txData: 전송할 데이터 버퍼의 포인터
+ * @param  txLen: 전송할 데이터의 길이 (바이트)
+ * @param  rxData: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  rxLen: 수신할 데이터의 길이 (바이트)
+ * @return I2C_Status: 전송 시작 결과
+ * @note   쓰기 단계의 마지막 BTF에서 반복 시작 조건을 생성하고 읽기 단계로 전환합니다.
+ * @warning 전송이 완료될 때까지 txData/rxData 버퍼는 유효해야 합니다.
+ */
+I2C_Status I2C_WriteReadData_IT(I2C_Handle *hi2c, uint8_t slaveAddr, uint8_t *txData, uint16_t txLen, uint8_t *rxData, uint16_t rxLen);
+
+/**
+ * @brief  트랜잭션 배치를 인터럽트 모드로 연속 실행합니다.
+ * @param  hi2c: I2C 핸들 구조체 포인터
+ * @param  list: 실행할 트랜잭션 디스크립터 배열
+ * @param  count: 트랜잭션 수
+ * @return I2C_Status: 배치 시작 결과
+ * @note   각 트랜잭션의 끝에서 정지 조건 대신 반복 시작 조건을 생성하여 다음 트랜잭션으로
+ *         바로 넘어가며, 정지 조건은 마지막 트랜잭션 뒤에 한 번만 생성합니다.
+ *         CPU는 배치 전체가 끝났을 때 XferCpltCallback으로 한 번만 통지받습니다.
+ * @warning
+ *         - 배치가 끝날 때까지 list 배열과 각 버퍼는 유효해야 합니다.
+ *         - 오류가 발생하면 배치를 중단하고 ErrorCallback을 호출합니다. 실패한 트랜잭션의
+ *           Status에 오류 코드가 기록되고, 실행되지 않은 트랜잭션은 I2C_BUSY로 남습니다.
+ */
+I2C_Status I2C_SubmitBatch_IT(I2C_Handle *hi2c, I2C_Transaction *list, uint16_t count);
+
+/**
+ * @brief  슬레이브 레지스터 맵 모드를 시작합니다.
+ * @param  hi2c: I2C 핸들 구조체 포인터
+ * @param  map: OwnAddress(OAR1)로 노출할 레지스터 맵
+ * @param  map2: OwnAddress2(OAR2)로 노출할 레지스터 맵 (NULL이면 map 공유)
+ * @return I2C_Status: 시작 결과
+ * @note   마스터는 포인터를 쓴 뒤 (반복) 시작 조건으로 읽어 애플리케이션 메모리를 복사 없이
+ *         직접 읽습니다. 바이트 단위 사용자 콜백은 없으며, 마스터의 쓰기가 끝나면(STOP 또는
+ *         다음 주소 일치) SlaveWriteCallback이 변경된 범위로 한 번 호출됩니다.
+ * @warning
+ *         - 슬레이브 모드 동안에는 같은 핸들로 마스터 전송을 시작할 수 없습니다 (I2C_BUSY).
+ *         - 레지스터 맵 메모리는 ISR에서 직접 접근하므로 애플리케이션은 다중 바이트 값을
+ *           원자적으로 갱신하도록 주의해야 합니다.
+ */
+I2C_Status I2C_Slave_StartRegMap_IT(I2C_Handle *hi2c, I2C_RegMap *map, I2C_RegMap *map2);
+
+/**
+ * @brief  슬레이브 레지스터 맵 모드를 종료합니다.
+ * @param  hi2c: I2C 핸들 구조체 포인터
+ * @return None
+ * @note   인터럽트를 비활성화하고 주소 응답(ACK)을 중지합니다.
+ */
+void I2C_Slave_Stop(I2C_Handle *hi2c);
+
+/**
+ * @brief  I2C 이벤트 인터럽트 핸들러입니다.
+ * @param  hi2c: I2C 핸들 구조체 포인터
+ * @return None
+ * @note   I2Cx_EV_IRQHandler에서 호출되어야 합니다.
+ * @warning NVIC에서 해당 I2C 이벤트/에러 인터럽트가 활성화되어 있어야 합니다.
+ */
+void I2C_EV_IRQHandler(I2C_Handle *hi2c);
+
+/**
+ * @brief  I2C 에러 인터럽트 핸들러입니다.
+ * @param  hi2c: I2C 핸들 구조체 포인터
+ * @return None
+ * @note   I2Cx_ER_IRQHandler에서 호출되어야 합니다. BERR/ARLO/AF/OVR 발생 시 전송을 중단하고
+ *         ErrorCallback을 호출합니다.
+ */
+void I2C_ER_IRQHandler(I2C_Handle *hi2c);
+
 /**
  * @brief  I2C 클럭을 설정합니다. (내부 함수)
  * @param  I2Cx: 설정할 I2C 주변장치 (I2C1 또는 I2C2)
@@ -0,0 +1,258 @@
+#include "i2c_cache.h"
+#include <assert.h>
+#include <string.h>
+
+/* 새 트랜잭션 대신 버스트에 포함할 최대 깨끗한 레지스터 수 (시작/주소/레지스터 주소 오버헤드 이하) */
+#define I2C_CACHE_MERGE_GAP 2
+
+/* 비트맵 비트 확인 내부 함수 */
+static uint8_t I2C_Cache_TestBit(const uint8_t *bitmap, uint16_t idx)
+{
+    return (bitmap[idx >> 3] >> (idx & 0x07)) & 0x01;
+}
+
+/* 비트맵 비트 설정 내부 함수 */
+static void I2C_Cache_SetBit(uint8_t *bitmap, uint16_t idx)
+{
+    bitmap[idx >> 3] |= (uint8_t)(1U << (idx & 0x07));
+}
+
+/* 비트맵 비트 클리어 내부 함수 */
+static void I2C_Cache_ClearBit(uint8_t *bitmap, uint16_t idx)
+{
+    bitmap[idx >> 3] &= (uint8_t)~(1U << (idx & 0x07));
+}
+
+/* 휘발성 레지스터 여부 확인 내부 함수 */
+static uint8_t I2C_Cache_IsVolatile(I2C_Cache *cache, uint16_t idx)
+{
+    return (cache->pVolatile != NULL) && I2C_Cache_TestBit(cache->pVolatile, idx);
+}
+
+/* 장치에서 다시 읽어야 하는지 확인하는 내부 함수 (dirty 레지스터는 섀도 값 유지) */
+static uint8_t I2C_Cache_NeedsFetch(I2C_Cache *cache, uint16_t idx, uint8_t force)
+{
+    if (I2C_Cache_TestBit(cache->pDirty, idx))
+    {
+        return 0;
+    }
+
+    return force || I2C_Cache_IsVolatile(cache, idx) || !I2C_Cache_TestBit(cache->pValid, idx);
+}
+
+/* 버스트에 포함해도 되는 깨끗한 레지스터인지 확인하는 내부 함수 */
+static uint8_t I2C_Cache_IsMergeable(I2C_Cache *cache, uint16_t idx)
+{
+    return I2C_Cache_TestBit(cache->pValid, idx) && !I2C_Cache_IsVolatile(cache, idx);
+}
+
+/* 레지스터 범위 확인 내부 함수 */
+static uint8_t I2C_Cache_InRange(I2C_Cache *cache, uint16_t reg, uint16_t len)
+{
+    return (reg >= cache->BaseAddr) && ((uint32_t)(reg - cache->BaseAddr) + len <= cache->Size);
+}
+
+/* [idx, idx + len) 구간에서 다시 읽어야 하는 연속 구간만 장치에서 읽는 내부 함수 */
+static I2C_Status I2C_Cache_Fetch(I2C_Cache *cache, uint16_t idx, uint16_t len, uint8_t force)
+{
+    I2C_Status status;
+    uint16_t end = idx + len;
+    uint16_t start;
+
+    while (idx < end)
+    {
+        if (!I2C_Cache_NeedsFetch(cache, idx, force))
+        {
+            idx++;
+            continue;
+        }
+
+        start = idx;
+        while (idx < end && I2C_Cache_NeedsFetch(cache, idx, force))
+        {
+            idx++;
+        }
+
+        status = I2C_MemRead(cache->Instance, cache->SlaveAddr, cache->BaseAddr + start, cache->MemAddSize,
+                             &cache->pShadow[start], idx - start);
+        if (status != I2C_OK)
+            return status;
+
+        for (uint16_t i = start; i < idx; i++)
+        {
+            I2C_Cache_SetBit(cache->pValid, i);
+        }
+    }
+
+    return I2C_OK;
+}
+
+/* 레지스터 캐시 초기화 */
+void I2C_Cache_Init(I2C_Cache *cache)
+{
+    /* 널 포인터 체크 */
+    assert(cache != NULL);
+    assert(cache->Instance != NULL);
+    assert(cache->pShadow != NULL);
+    assert(cache->pDirty != NULL);
+    assert(cache->pValid != NULL);
+
+    memset(cache->pDirty, 0, I2C_CACHE_BITMAP_SIZE(cache->Size));
+    memset(cache->pValid, 0, I2C_CACHE_BITMAP_SIZE(cache->Size));
+}
+
+/* 캐시 무효화 */
+void I2C_Cache_Invalidate(I2C_Cache *cache)
+{
+    /* 널 포인터 체크 */
+    assert(cache != NULL);
+
+    memset(cache->pDirty, 0, I2C_CACHE_BITMAP_SIZE(cache->Size));
+    memset(cache->pValid, 0, I2C_CACHE_BITMAP_SIZE(cache->Size));
+}
+
+/* 전체 레지스터 블록 동기화 */
+I2C_Status I2C_Cache_Sync(I2C_Cache *cache)
+{
+    /* 널 포인터 체크 */
+    assert(cache != NULL);
+
+    return I2C_Cache_Fetch(cache, 0, cache->Size, 1);
+}
+
+/* 레지스터 읽기 */
+I2C_Status I2C_Cache_Read(I2C_Cache *cache, uint16_t reg, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(cache != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    I2C_Status status;
+    uint16_t idx = reg - cache->BaseAddr;
+
+    if (!I2C_Cache_InRange(cache, reg, len))
+    {
+        return I2C_ERROR;
+    }
+
+    /* 섀도로 응답할 수 없는 구간만 장치에서 읽음 */
+    status = I2C_Cache_Fetch(cache, idx, len, 0);
+    if (status != I2C_OK)
+        return status;
+
+    memcpy(data, &cache->pShadow[idx], len);
+
+    return I2C_OK;
+}
+
+/* 레지스터 쓰기 (섀도) */
+I2C_Status I2C_Cache_Write(I2C_Cache *cache, uint16_t reg, const uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(cache != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    uint16_t idx = reg - cache->BaseAddr;
+
+    if (!I2C_Cache_InRange(cache, reg, len))
+    {
+        return I2C_ERROR;
+    }
+
+    for (uint16_t i = idx; i < idx + len; i++, data++)
+    {
+        /* 값이 같은 비휘발성 레지스터는 다시 쓸 필요 없음 (휘발성 레지스터는 쓰기 자체가 동작) */
+        if (I2C_Cache_TestBit(cache->pValid, i) && !I2C_Cache_IsVolatile(cache, i) && cache->pShadow[i] == *data)
+        {
+            continue;
+        }
+
+        cache->pShadow[i] = *data;
+        I2C_Cache_SetBit(cache->pValid, i);
+        I2C_Cache_SetBit(cache->pDirty, i);
+    }
+
+    return I2C_OK;
+}
+
+/* 레지스터 비트 변경 */
+I2C_Status I2C_Cache_UpdateBits(I2C_Cache *cache, uint16_t reg, uint8_t mask, uint8_t value)
+{
+    /* 널 포인터 체크 */
+    assert(cache != NULL);
+
+    I2C_Status status;
+    uint8_t data;
+
+    status = I2C_Cache_Read(cache, reg, &data, 1);
+    if (status != I2C_OK)
+        return status;
+
+    data = (uint8_t)((data & ~mask) | (value & mask));
+
+    return I2C_Cache_Write(cache, reg, &data, 1);
+}
+
+/* dirty 레지스터 반영 */
+I2C_Status I2C_Cache_Flush(I2C_Cache *cache)
+{
+    /* 널 포인터 체크 */
+    assert(cache != NULL);
+
+    I2C_Status status;
+    uint16_t idx = 0;
+    uint16_t start;
+    uint16_t end;
+    uint16_t gap;
+
+    while (idx < cache->Size)
+    {
+        if (!I2C_Cache_TestBit(cache->pDirty, idx))
+        {
+            idx++;
+            continue;
+        }
+
+        /* 연속 dirty 구간 확장 - 짧은 깨끗한 구간은 버스트에 포함 */
+        start = idx;
+        end = idx + 1;
+        while (end < cache->Size)
+        {
+            gap = 0;
+            while (end + gap < cache->Size && gap < I2C_CACHE_MERGE_GAP &&
+                   !I2C_Cache_TestBit(cache->pDirty, end + gap) && I2C_Cache_IsMergeable(cache, end + gap))
+            {
+                gap++;
+            }
+
+            if (end + gap >= cache->Size || !I2C_Cache_TestBit(cache->pDirty, end + gap))
+            {
+                break;
+            }
+            if (cache->MaxBurst && (end + gap + 1 - start) > cache->MaxBurst)
+            {
+                break;
+            }
+
+            end += gap + 1;
+        }
+
+        status = I2C_MemWrite(cache->Instance, cache->SlaveAddr, cache->BaseAddr + start, cache->MemAddSize,
+                              &cache->pShadow[start], end - start);
+        if (status != I2C_OK)
+            return status;
+
+        for (uint16_t i = start; i < end; i++)
+        {
+            I2C_Cache_ClearBit(cache->pDirty, i);
+        }
+
+        idx = end;
+    }
+
+    return I2C_OK;
+}
@@ -0,0 +1,98 @@
+#ifndef __I2C_CACHE_H
+#define __I2C_CACHE_H
+
+#include "i2c.h"
+
+/**
+ * @brief 레지스터 수에 필요한 비트맵 크기 (바이트)
+ */
+#define I2C_CACHE_BITMAP_SIZE(n) (((n) + 7) / 8)
+
+/**
+ * @brief I2C 장치 레지스터 섀도 캐시 구조체
+ * @note  저장 공간(pShadow, pDirty, pValid)은 사용자가 제공하며,
+ *        레지스터 주소는 BaseAddr부터 연속이라고 가정합니다 (자동 증가 버스트 사용).
+ */
+typedef struct
+{
+    I2C_TypeDef *Instance;     /*!< 장치가 연결된 I2C 주변장치 */
+    uint8_t SlaveAddr;         /*!< 장치의 7비트 주소 */
+    I2C_MemAddSize MemAddSize; /*!< 레지스터 주소 크기 */
+    uint16_t BaseAddr;         /*!< 캐시가 다루는 첫 번째 레지스터 주소 */
+    uint16_t Size;             /*!< 캐시하는 레지스터 수 */
+    uint16_t MaxBurst;         /*!< 한 번에 쓸 수 있는 최대 바이트 수. 0: 제한 없음 */
+    uint8_t *pShadow;          /*!< 섀도 레지스터 (Size 바이트) */
+    uint8_t *pDirty;           /*!< 장치에 아직 쓰지 않은 레지스터 비트맵 (I2C_CACHE_BITMAP_SIZE(Size) 바이트) */
+    uint8_t *pValid;           /*!< 섀도 값을 알고 있는(읽었거나 새로 쓴) 레지스터 비트맵 (I2C_CACHE_BITMAP_SIZE(Size) 바이트) */
+    const uint8_t *pVolatile;  /*!< 항상 장치에서 읽어야 하는 레지스터 비트맵 (상태/데이터 레지스터). NULL: 없음 */
+} I2C_Cache;
+
+/**
+ * @brief  레지스터 캐시를 초기화합니다.
+ * @param  cache: 초기화할 캐시 구조체의 포인터
+ * @return None
+ * @note   모든 레지스터를 유효하지 않음/깨끗함으로 표시합니다. 장치 통신은 하지 않습니다.
+ */
+void I2C_Cache_Init(I2C_Cache *cache);
+
+/**
+ * @brief  캐시된 모든 레지스터를 무효화합니다.
+ * @param  cache: 대상 캐시 구조체의 포인터
+ * @return None
+ * @note   장치 리셋 이후 호출합니다. 아직 쓰지 않은(dirty) 변경 내용도 버려집니다.
+ */
+void I2C_Cache_Invalidate(I2C_Cache *cache);
+
+/**
+ * @brief  장치에서 전체 레지스터 블록을 읽어 섀도를 채웁니다.
+ * @param  cache: 대상 캐시 구조체의 포인터
+ * @return I2C_Status: 읽기 결과
+ * @note   dirty 레지스터는 덮어쓰지 않도록 건너뜁니다.
+ */
+I2C_Status I2C_Cache_Sync(I2C_Cache *cache);
+
+/**
+ * @brief  레지스터를 읽습니다.
+ * @param  cache: 대상 캐시 구조체의 포인터
+ * @param  reg: 시작 레지스터 주소
+ * @param  data: 읽은 값을 저장할 버퍼의 포인터
+ * @param  len: 읽을 레지스터 수
+ * @return I2C_Status: 읽기 결과
+ * @note   유효한 비휘발성 레지스터와 dirty 레지스터는 섀도에서 바로 반환하고,
+ *         나머지 연속 구간만 자동 증가 버스트로 장치에서 읽습니다.
+ */
+I2C_Status I2C_Cache_Read(I2C_Cache *cache, uint16_t reg, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  레지스터 값을 섀도에 씁니다.
+ * @param  cache: 대상 캐시 구조체의 포인터
+ * @param  reg: 시작 레지스터 주소
+ * @param  data: 쓸 값 버퍼의 포인터
+ * @param  len: 쓸 레지스터 수
+ * @return I2C_Status: 쓰기 결과 (범위를 벗어나면 I2C_ERROR)
+ * @note   값이 바뀐 레지스터만 dirty로 표시합니다. 장치에는 I2C_Cache_Flush() 호출 시 반영됩니다.
+ */
+I2C_Status I2C_Cache_Write(I2C_Cache *cache, uint16_t reg, const uint8_t *data, uint16_t len);
+
+/**
+ * @brief  레지스터의 일부 비트를 변경합니다 (읽기-수정-쓰기).
+ * @param  cache: 대상 캐시 구조체의 포인터
+ * @param  reg: 레지스터 주소
+ * @param  mask: 변경할 비트 마스크
+ * @param  value: 새 비트 값 (mask 위치만 사용)
+ * @return I2C_Status: 처리 결과
+ * @note   섀도가 유효하면 장치를 읽지 않습니다.
+ */
+I2C_Status I2C_Cache_UpdateBits(I2C_Cache *cache, uint16_t reg, uint8_t mask, uint8_t value);
+
+/**
+ * @brief  dirty 레지스터를 장치에 씁니다.
+ * @param  cache: 대상 캐시 구조체의 포인터
+ * @return I2C_Status: 쓰기 결과
+ * @note   연속된 dirty 구간을 하나의 자동 증가 버스트로 전송합니다. 사이의 깨끗한 구간이
+ *         짧고 유효한 비휘발성 레지스터뿐이면 새 트랜잭션 대신 같은 버스트에 포함합니다.
+ * @warning 실패한 구간과 그 이후 구간은 dirty로 남으므로 다시 호출하여 재시도할 수 있습니다.
+ */
+I2C_Status I2C_Cache_Flush(I2C_Cache *cache);
+
+#endif /* __I2C_CACHE_H */
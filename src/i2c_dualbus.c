@@ -0,0 +1,121 @@
+#include "i2c_dualbus.h"
+#include <assert.h>
+
+/* 버스 배치 완료/오류 콜백 내부 함수 - 마지막으로 끝난 버스가 라운드 완료를 통지 */
+static void I2C_DualBus_BusDone(I2C_Handle *hi2c)
+{
+    I2C_DualBus *sched = (I2C_DualBus *)hi2c->pContext;
+
+    if (hi2c->ErrorCode != I2C_OK && sched->Status == I2C_OK)
+    {
+        sched->Status = hi2c->ErrorCode;
+    }
+
+    if (--sched->Pending == 0 && sched->RoundCpltCallback != NULL)
+    {
+        sched->RoundCpltCallback(sched);
+    }
+}
+
+/* 듀얼 버스 스케줄러 초기화 */
+void I2C_DualBus_Init(I2C_DualBus *sched)
+{
+    /* 널 포인터 체크 */
+    assert(sched != NULL);
+
+    for (uint8_t bus = 0; bus < 2; bus++)
+    {
+        /* 널 포인터 체크 */
+        assert(sched->pBus[bus] != NULL);
+        assert(sched->pList[bus] != NULL);
+
+        sched->pBus[bus]->pContext = sched;
+        sched->pBus[bus]->XferCpltCallback = I2C_DualBus_BusDone;
+        sched->pBus[bus]->ErrorCallback = I2C_DualBus_BusDone;
+        sched->Count[bus] = 0;
+    }
+
+    sched->Pending = 0;
+    sched->Status = I2C_OK;
+}
+
+/* 트랜잭션 등록 */
+I2C_Status I2C_DualBus_Add(I2C_DualBus *sched, I2C_DualBus_Index bus, const I2C_Transaction *xfer)
+{
+    /* 널 포인터 체크 */
+    assert(sched != NULL);
+    assert(xfer != NULL);
+
+    if (sched->Pending != 0 || sched->Count[bus] >= sched->Capacity[bus])
+    {
+        return I2C_BUSY;
+    }
+
+    sched->pList[bus][sched->Count[bus]++] = *xfer;
+
+    return I2C_OK;
+}
+
+/* 등록된 트랜잭션 제거 */
+void I2C_DualBus_Clear(I2C_DualBus *sched)
+{
+    /* 널 포인터 체크 */
+    assert(sched != NULL);
+
+    sched->Count[I2C_DUALBUS_0] = 0;
+    sched->Count[I2C_DUALBUS_1] = 0;
+}
+
+/* 라운드 시작 */
+I2C_Status I2C_DualBus_StartRound(I2C_DualBus *sched)
+{
+    /* 널 포인터 체크 */
+    assert(sched != NULL);
+
+    uint8_t active = 0;
+
+    /* 제출이 중간에 실패하지 않도록 두 버스의 상태를 먼저 확인 */
+    if (sched->Pending != 0)
+    {
+        return I2C_BUSY;
+    }
+    for (uint8_t bus = 0; bus < 2; bus++)
+    {
+        if (sched->Count[bus] > 0)
+        {
+            if (sched->pBus[bus]->State != I2C_STATE_READY)
+            {
+                return I2C_BUSY;
+            }
+            active++;
+        }
+    }
+
+    if (active == 0)
+    {
+        return I2C_ERROR;
+    }
+
+    /* 완료 콜백이 먼저 실행되어도 판정이 맞도록 제출 전에 대기 수 설정 */
+    sched->Status = I2C_OK;
+    sched->Pending = active;
+
+    for (uint8_t bus = 0; bus < 2; bus++)
+    {
+        if (sched->Count[bus] > 0)
+        {
+            I2C_SubmitBatch_IT(sched->pBus[bus], sched->pList[bus], sched->Count[bus]);
+        }
+    }
+
+    return I2C_OK;
+}
+
+/* 라운드 진행 여부 확인 */
+uint8_t I2C_DualBus_IsBusy(I2C_DualBus *sched)
+{
+    /* 널 포인터 체크 */
+    assert(sched != NULL);
+
+    return sched->Pending != 0;
+}
@@ -0,0 +1,72 @@
+#ifndef __I2C_DUALBUS_H
+#define __I2C_DUALBUS_H
+
+#include "i2c.h"
+
+/**
+ * @brief 듀얼 버스 인덱스 정의
+ */
+typedef enum
+{
+    I2C_DUALBUS_0 = 0, /*!< 첫 번째 버스 (일반적으로 I2C1) */
+    I2C_DUALBUS_1      /*!< 두 번째 버스 (일반적으로 I2C2) */
+} I2C_DualBus_Index;
+
+/**
+ * @brief I2C1/I2C2 듀얼 버스 스케줄러 구조체
+ * @note  각 버스는 I2C_InitHandle()로 초기화된 핸들을 사용하며, 트랜잭션 배열 저장 공간은 사용자가 제공합니다.
+ */
+typedef struct __I2C_DualBus
+{
+    I2C_Handle      *pBus[2];      /*!< 버스별 I2C 핸들 */
+    I2C_Transaction *pList[2];     /*!< 버스별 트랜잭션 배열 (사용자 제공) */
+    uint16_t         Capacity[2];  /*!< 버스별 트랜잭션 배열 크기 */
+    uint16_t         Count[2];     /*!< 버스별 등록된 트랜잭션 수 */
+    volatile uint8_t Pending;      /*!< 아직 끝나지 않은 버스 수 */
+    volatile I2C_Status Status;    /*!< 라운드 결과 (두 버스 중 첫 번째 오류, 모두 성공하면 I2C_OK) */
+    void (*RoundCpltCallback)(struct __I2C_DualBus *sched); /*!< 라운드 완료 콜백 (NULL 허용) */
+} I2C_DualBus;
+
+/**
+ * @brief  듀얼 버스 스케줄러를 초기화합니다.
+ * @param  sched: 스케줄러 구조체 포인터 (pBus, pList, Capacity 설정 후 호출)
+ * @return None
+ * @note   각 핸들의 XferCpltCallback/ErrorCallback과 pContext를 스케줄러용으로 설정합니다.
+ * @warning 두 버스의 이벤트/에러 인터럽트는 같은 선점 우선순위로 설정해야 합니다 (완료 판정이 중첩되지 않도록).
+ */
+void I2C_DualBus_Init(I2C_DualBus *sched);
+
+/**
+ * @brief  버스에 트랜잭션(장치 읽기/쓰기)을 등록합니다.
+ * @param  sched: 스케줄러 구조체 포인터
+ * @param  bus: 장치가 연결된 버스
+ * @param  xfer: 등록할 트랜잭션 (내용이 복사됨, 버퍼는 라운드 동안 유효해야 함)
+ * @return I2C_Status: 등록 결과 (배열이 가득 찼거나 라운드 진행 중이면 I2C_BUSY)
+ */
+I2C_Status I2C_DualBus_Add(I2C_DualBus *sched, I2C_DualBus_Index bus, const I2C_Transaction *xfer);
+
+/**
+ * @brief  등록된 트랜잭션을 모두 제거합니다.
+ * @param  sched: 스케줄러 구조체 포인터
+ * @return None
+ */
+void I2C_DualBus_Clear(I2C_DualBus *sched);
+
+/**
+ * @brief  두 버스에서 등록된 트랜잭션을 동시에 시작합니다 (라운드).
+ * @param  sched: 스케줄러 구조체 포인터
+ * @return I2C_Status: 시작 결과
+ * @note   버스마다 I2C_SubmitBatch_IT()로 배치를 제출하고 즉시 반환합니다. 두 컨트롤러가 병렬로
+ *         동작하므로 라운드 시간은 두 버스 중 긴 쪽의 시간이 됩니다. 두 버스가 모두 끝나면
+ *         RoundCpltCallback이 한 번 호출됩니다. 등록된 트랜잭션은 다음 라운드에서 그대로 재사용됩니다.
+ */
+I2C_Status I2C_DualBus_StartRound(I2C_DualBus *sched);
+
+/**
+ * @brief  라운드가 진행 중인지 확인합니다.
+ * @param  sched: 스케줄러 구조체 포인터
+ * @return uint8_t: 1(진행 중), 0(완료)
+ */
+uint8_t I2C_DualBus_IsBusy(I2C_DualBus *sched);
+
+#endif /* __I2C_DUALBUS_H */
@@ -0,0 +1,152 @@
+#include "i2c_mux.h"
+#include <assert.h>
+
+/* 채널 제어 레지스터 쓰기 내부 함수 (캐시와 같으면 생략) */
+static I2C_Status I2C_Mux_WriteControl(I2C_Mux *mux, uint8_t control)
+{
+    I2C_Status status;
+
+    if (mux->CacheValid && mux->Control == control)
+    {
+        return I2C_OK;
+    }
+
+    status = I2C_WriteData(mux->Instance, mux->MuxAddress, &control, 1);
+    if (status != I2C_OK)
+    {
+        /* 쓰기 결과를 알 수 없으므로 다음 선택은 반드시 장치에 씀 */
+        mux->CacheValid = 0;
+        return status;
+    }
+
+    mux->Control = control;
+    mux->CacheValid = 1;
+
+    return I2C_OK;
+}
+
+/* 큐 정렬 키 계산 내부 함수 - 현재 선택된 채널이 0이 되도록 회전 */
+static uint8_t I2C_Mux_SortKey(uint8_t first, uint8_t channel)
+{
+    return (uint8_t)((channel - first) & (I2C_MUX_CHANNELS - 1));
+}
+
+/* 멀티플렉서 초기화 */
+void I2C_Mux_Init(I2C_Mux *mux)
+{
+    /* 널 포인터 체크 */
+    assert(mux != NULL);
+    assert(mux->Instance != NULL);
+
+    mux->Control = 0;
+    mux->CacheValid = 0;
+}
+
+/* 채널 캐시 무효화 */
+void I2C_Mux_Invalidate(I2C_Mux *mux)
+{
+    /* 널 포인터 체크 */
+    assert(mux != NULL);
+
+    mux->CacheValid = 0;
+}
+
+/* 채널 선택 */
+I2C_Status I2C_Mux_Select(I2C_Mux *mux, uint8_t channel)
+{
+    /* 널 포인터 체크 */
+    assert(mux != NULL);
+    /* 채널 범위 체크 */
+    assert(channel < I2C_MUX_CHANNELS);
+
+    return I2C_Mux_WriteControl(mux, (uint8_t)(1U << channel));
+}
+
+/* 모든 채널 해제 */
+I2C_Status I2C_Mux_Disable(I2C_Mux *mux)
+{
+    /* 널 포인터 체크 */
+    assert(mux != NULL);
+
+    return I2C_Mux_WriteControl(mux, 0);
+}
+
+/* 채널 선택 후 트랜잭션 실행 */
+I2C_Status I2C_Mux_Transfer(I2C_Mux *mux, uint8_t channel, I2C_Transaction *xfer)
+{
+    /* 널 포인터 체크 */
+    assert(mux != NULL);
+    assert(xfer != NULL);
+
+    I2C_Status status = I2C_Mux_Select(mux, channel);
+    if (status != I2C_OK)
+    {
+        xfer->Status = status;
+        return status;
+    }
+
+    return I2C_Transfer(mux->Instance, xfer);
+}
+
+/* 채널 뒤 장치에 쓰기 */
+I2C_Status I2C_Mux_WriteData(I2C_Mux *mux, uint8_t channel, uint8_t slaveAddr, uint8_t *data, uint16_t len)
+{
+    I2C_Transaction xfer = {.DevAddress = slaveAddr, .pTxBuffer = data, .TxSize = len};
+
+    return I2C_Mux_Transfer(mux, channel, &xfer);
+}
+
+/* 채널 뒤 장치에서 읽기 */
+I2C_Status I2C_Mux_ReadData(I2C_Mux *mux, uint8_t channel, uint8_t slaveAddr, uint8_t *data, uint16_t len)
+{
+    I2C_Transaction xfer = {.DevAddress = slaveAddr, .pRxBuffer = data, .RxSize = len};
+
+    return I2C_Mux_Transfer(mux, channel, &xfer);
+}
+
+/* 요청 큐 실행 */
+I2C_Status I2C_Mux_RunQueue(I2C_Mux *mux, I2C_MuxRequest *list, uint16_t count)
+{
+    /* 널 포인터 체크 */
+    assert(mux != NULL);
+    assert(list != NULL);
+
+    I2C_Status status;
+    I2C_Status result = I2C_OK;
+    I2C_MuxRequest tmp;
+    uint8_t first = 0;
+    uint16_t j;
+
+    /* 현재 선택된 채널부터 시작 (단일 채널이 선택된 경우) */
+    if (mux->CacheValid && mux->Control != 0 && (mux->Control & (mux->Control - 1)) == 0)
+    {
+        while (!(mux->Control & (1U << first)))
+        {
+            first++;
+        }
+    }
+
+    /* 채널 기준 안정 삽입 정렬 - 큐는 보통 수십 개 이하 */
+    for (uint16_t i = 1; i < count; i++)
+    {
+        tmp = list[i];
+        j = i;
+        while (j > 0 && I2C_Mux_SortKey(first, list[j - 1].Channel) > I2C_Mux_SortKey(first, tmp.Channel))
+        {
+            list[j] = list[j - 1];
+            j--;
+        }
+        list[j] = tmp;
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        status = I2C_Mux_Transfer(mux, list[i].Channel, &list[i].Xfer);
+        if (status != I2C_OK && result == I2C_OK)
+        {
+            result = status;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,106 @@
+#ifndef __I2C_MUX_H
+#define __I2C_MUX_H
+
+#include "i2c.h"
+
+/**
+ * @brief 멀티플렉서 채널 수 (TCA9548A)
+ */
+#define I2C_MUX_CHANNELS 8
+
+/**
+ * @brief TCA9548A 계열 I2C 멀티플렉서 구조체
+ */
+typedef struct
+{
+    I2C_TypeDef *Instance; /*!< 멀티플렉서가 연결된 I2C 주변장치 */
+    uint8_t MuxAddress;    /*!< 멀티플렉서 7비트 주소 (0x70-0x77) */
+    uint8_t Control;       /*!< 마지막으로 쓴 채널 제어 레지스터 값 (캐시) */
+    uint8_t CacheValid;    /*!< Control 값이 실제 장치 상태와 일치하는지 여부 */
+} I2C_Mux;
+
+/**
+ * @brief 멀티플렉서 채널 요청 구조체 (큐 실행용)
+ */
+typedef struct
+{
+    uint8_t Channel;      /*!< 장치가 연결된 채널 (0-7) */
+    I2C_Transaction Xfer; /*!< 채널 선택 후 실행할 트랜잭션 (결과는 Xfer.Status) */
+} I2C_MuxRequest;
+
+/**
+ * @brief  멀티플렉서 구조체를 초기화합니다.
+ * @param  mux: 멀티플렉서 구조체 포인터 (Instance, MuxAddress 설정 후 호출)
+ * @return None
+ * @note   장치 통신은 하지 않으며, 첫 번째 채널 선택은 항상 장치에 씁니다.
+ */
+void I2C_Mux_Init(I2C_Mux *mux);
+
+/**
+ * @brief  채널 캐시를 무효화합니다.
+ * @param  mux: 멀티플렉서 구조체 포인터
+ * @return None
+ * @note   멀티플렉서 리셋 또는 다른 마스터가 채널을 바꿨을 수 있을 때 호출합니다.
+ */
+void I2C_Mux_Invalidate(I2C_Mux *mux);
+
+/**
+ * @brief  하나의 채널을 선택합니다.
+ * @param  mux: 멀티플렉서 구조체 포인터
+ * @param  channel: 선택할 채널 (0-7)
+ * @return I2C_Status: 선택 결과
+ * @note   이미 선택된 채널이면 버스 트랜잭션 없이 I2C_OK를 반환합니다.
+ */
+I2C_Status I2C_Mux_Select(I2C_Mux *mux, uint8_t channel);
+
+/**
+ * @brief  모든 채널을 해제합니다.
+ * @param  mux: 멀티플렉서 구조체 포인터
+ * @return I2C_Status: 해제 결과
+ */
+I2C_Status I2C_Mux_Disable(I2C_Mux *mux);
+
+/**
+ * @brief  채널을 선택한 뒤 트랜잭션을 실행합니다.
+ * @param  mux: 멀티플렉서 구조체 포인터
+ * @param  channel: 장치가 연결된 채널 (0-7)
+ * @param  xfer: 실행할 트랜잭션 (I2C_Transfer 사용)
+ * @return I2C_Status: 실행 결과
+ */
+I2C_Status I2C_Mux_Transfer(I2C_Mux *mux, uint8_t channel, I2C_Transaction *xfer);
+
+/**
+ * @brief  채널 뒤의 장치에 데이터를 씁니다.
+ * @param  mux: 멀티플렉서 구조체 포인터
+ * @param  channel: 장치가 연결된 채널 (0-7)
+ * @param  slaveAddr: 대상 장치의 7비트 주소
+ * @param  data: 전송할 데이터 버퍼의 포인터
+ * @param  len: 전송할 데이터의 길이 (바이트)
+ * @return I2C_Status: 데이터 전송 결과
+ */
+I2C_Status I2C_Mux_WriteData(I2C_Mux *mux, uint8_t channel, uint8_t slaveAddr, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  채널 뒤의 장치에서 데이터를 읽습니다.
+ * @param  mux: 멀티플렉서 구조체 포인터
+ * @param  channel: 장치가 연결된 채널 (0-7)
+ * @param  slaveAddr: 대상 장치의 7비트 주소
+ * @param  data: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 수신할 데이터의 길이 (바이트)
+ * @return I2C_Status: 데이터 수신 결과
+ */
+I2C_Status I2C_Mux_ReadData(I2C_Mux *mux, uint8_t channel, uint8_t slaveAddr, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  요청 큐를 채널별로 묶어 실행합니다.
+ * @param  mux: 멀티플렉서 구조체 포인터
+ * @param  list: 요청 배열 (채널 순서로 재정렬됨)
+ * @param  count: 요청 수
+ * @return I2C_Status: 첫 번째로 실패한 요청의 상태 (모두 성공하면 I2C_OK)
+ * @note   현재 선택된 채널의 요청부터 시작하여 채널 번호 순으로 안정 정렬하므로
+ *         채널 선택 쓰기는 채널당 최대 한 번만 발생합니다. 실패한 요청이 있어도 나머지를 계속 실행합니다.
+ * @warning list의 순서가 바뀝니다. 같은 채널 안에서는 원래 순서가 유지됩니다.
+ */
+I2C_Status I2C_Mux_RunQueue(I2C_Mux *mux, I2C_MuxRequest *list, uint16_t count);
+
+#endif /* __I2C_MUX_H */
@@ -0,0 +1,74 @@
+#include "rcc.h"
+
+/* CFGR 필드 위치 (RM0383 6.3.3) */
+#define RCC_CFGR_SWS_POS   2
+#define RCC_CFGR_HPRE_POS  4
+#define RCC_CFGR_PPRE1_POS 10
+#define RCC_CFGR_PPRE2_POS 13
+
+/* PLLCFGR 필드 위치 (RM0383 6.3.2) */
+#define RCC_PLLCFGR_PLLN_POS   6
+#define RCC_PLLCFGR_PLLP_POS   16
+#define RCC_PLLCFGR_PLLSRC_POS 22
+
+/* APB 분주 필드(PPREx) 값을 분주비 시프트 수로 변환하는 내부 함수 (0xx: 1, 100: 2, ... 111: 16) */
+static uint8_t RCC_APBShift(uint32_t ppre)
+{
+    return (ppre & 0x4) ? (uint8_t)((ppre & 0x3) + 1) : 0;
+}
+
+/* 시스템 클럭 주파수 */
+uint32_t RCC_GetSystemClock(void)
+{
+    uint32_t pllcfgr;
+    uint32_t pllin;
+    uint32_t pllm;
+    uint32_t plln;
+    uint32_t pllp;
+
+    switch ((RCC->CFGR >> RCC_CFGR_SWS_POS) & 0x3)
+    {
+    case 1: // HSE
+        return RCC_HSE_VALUE;
+    case 2: // PLL
+        pllcfgr = RCC->PLLCFGR;
+        pllin = ((pllcfgr >> RCC_PLLCFGR_PLLSRC_POS) & 0x1) ? RCC_HSE_VALUE : RCC_HSI_VALUE;
+        pllm = pllcfgr & 0x3F;
+        plln = (pllcfgr >> RCC_PLLCFGR_PLLN_POS) & 0x1FF;
+        pllp = (((pllcfgr >> RCC_PLLCFGR_PLLP_POS) & 0x3) + 1) * 2;
+        if (pllm == 0)
+        {
+            return RCC_HSI_VALUE;
+        }
+        /* VCO 입력(1-2MHz)을 먼저 구해 32비트 오버플로 방지 */
+        return (pllin / pllm) * plln / pllp;
+    default: // HSI
+        return RCC_HSI_VALUE;
+    }
+}
+
+/* AHB 클럭 주파수 */
+uint32_t RCC_GetHCLK(void)
+{
+    static const uint8_t ahb_shift[8] = {1, 2, 3, 4, 6, 7, 8, 9}; // HPRE 1xxx: 2, 4, 8, 16, 64, 128, 256, 512
+    uint32_t hpre = (RCC->CFGR >> RCC_CFGR_HPRE_POS) & 0xF;
+
+    if (!(hpre & 0x8))
+    {
+        return RCC_GetSystemClock();
+    }
+
+    return RCC_GetSystemClock() >> ahb_shift[hpre & 0x7];
+}
+
+/* APB1 클럭 주파수 */
+uint32_t RCC_GetPCLK1(void)
+{
+    return RCC_GetHCLK() >> RCC_APBShift((RCC->CFGR >> RCC_CFGR_PPRE1_POS) & 0x7);
+}
+
+/* APB2 클럭 주파수 */
+uint32_t RCC_GetPCLK2(void)
+{
+    return RCC_GetHCLK() >> RCC_APBShift((RCC->CFGR >> RCC_CFGR_PPRE2_POS) & 0x7);
+}
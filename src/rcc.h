@@ -0,0 +1,46 @@
+#ifndef __RCC_H
+#define __RCC_H
+
+#include "stm32f411xe.h"
+
+/**
+ * @brief 외부 오실레이터(HSE) 주파수 (Hz)
+ * @note  보드에 실장된 크리스탈에 맞게 수정합니다.
+ */
+#define RCC_HSE_VALUE 25000000UL
+
+/**
+ * @brief 내부 오실레이터(HSI) 주파수 (Hz)
+ */
+#define RCC_HSI_VALUE SYSTEM_CLOCK_DEFAULT
+
+/**
+ * @brief  현재 시스템 클럭(SYSCLK) 주파수를 반환합니다.
+ * @param  None
+ * @return uint32_t: SYSCLK 주파수 (Hz)
+ * @note   CFGR의 SWS(실제 선택된 클럭 소스)와 PLLCFGR을 읽어 계산하므로 클럭 변경 직후에도 정확합니다.
+ */
+uint32_t RCC_GetSystemClock(void);
+
+/**
+ * @brief  AHB 버스 클럭(HCLK) 주파수를 반환합니다.
+ * @param  None
+ * @return uint32_t: HCLK 주파수 (Hz)
+ */
+uint32_t RCC_GetHCLK(void);
+
+/**
+ * @brief  APB1 버스 클럭(PCLK1) 주파수를 반환합니다.
+ * @param  None
+ * @return uint32_t: PCLK1 주파수 (Hz, I2C1/2, SPI2/3, USART2)
+ */
+uint32_t RCC_GetPCLK1(void);
+
+/**
+ * @brief  APB2 버스 클럭(PCLK2) 주파수를 반환합니다.
+ * @param  None
+ * @return uint32_t: PCLK2 주파수 (Hz, SPI1, USART1/6)
+ */
+uint32_t RCC_GetPCLK2(void);
+
+#endif /* __RCC_H */
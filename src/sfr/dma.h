@@ -0,0 +1,30 @@
+#ifndef __DMA_SFR_H
+#define __DMA_SFR_H
+
+#include <stdint.h>
+
+/**
+ * @brief DMA 스트림 레지스터 구조체
+ */
+typedef struct
+{
+    volatile uint32_t CR;    /*!< DMA stream x configuration register,      Address offset: 0x10 + 0x18 * x */
+    volatile uint32_t NDTR;  /*!< DMA stream x number of data register,     Address offset: 0x14 + 0x18 * x */
+    volatile uint32_t PAR;   /*!< DMA stream x peripheral address register, Address offset: 0x18 + 0x18 * x */
+    volatile uint32_t M0AR;  /*!< DMA stream x memory 0 address register,   Address offset: 0x1C + 0x18 * x */
+    volatile uint32_t M1AR;  /*!< DMA stream x memory 1 address register,   Address offset: 0x20 + 0x18 * x */
+    volatile uint32_t FCR;   /*!< DMA stream x FIFO control register,       Address offset: 0x24 + 0x18 * x */
+} DMA_Stream_TypeDef;
+
+/**
+ * @brief DMA 컨트롤러 레지스터 구조체
+ */
+typedef struct
+{
+    volatile uint32_t LISR;  /*!< DMA low interrupt status register,      Address offset: 0x00 */
+    volatile uint32_t HISR;  /*!< DMA high interrupt status register,     Address offset: 0x04 */
+    volatile uint32_t LIFCR; /*!< DMA low interrupt flag clear register,  Address offset: 0x08 */
+    volatile uint32_t HIFCR; /*!< DMA high interrupt flag clear register, Address offset: 0x0C */
+} DMA_TypeDef;
+
+#endif /* __DMA_SFR_H */
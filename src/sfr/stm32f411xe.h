@@ -2,6 +2,7 @@
 #define __STM32F411xE_H
 
 #include <stdint.h>
+#include "sfr/dma.h"
 #include "sfr/gpio.h"
 #include "sfr/i2c.h"
 #include "sfr/rcc.h"
@@ -38,6 +39,8 @@
 #define GPIOE_BASE         (AHB1PERIPH_BASE + 0x1000UL)
 #define GPIOH_BASE         (AHB1PERIPH_BASE + 0x1C00UL)
 #define RCC_BASE           (AHB1PERIPH_BASE + 0x3800UL)
+#define DMA1_BASE          (AHB1PERIPH_BASE + 0x6000UL)
+#define DMA2_BASE          (AHB1PERIPH_BASE + 0x6400UL)
 
 /* 시스템 클럭 설정 */
 #define SYSTEM_CLOCK_DEFAULT 16000000UL /* 기본 시스템 클럭 (16MHz) */
@@ -55,6 +58,8 @@
 #define I2C1              ((I2C_TypeDef *)I2C1_BASE)
 #define I2C2              ((I2C_TypeDef *)I2C2_BASE)
 #define RCC               ((RCC_TypeDef *)RCC_BASE)
+#define DMA1              ((DMA_TypeDef *)DMA1_BASE)
+#define DMA2              ((DMA_TypeDef *)DMA2_BASE)
 #define USART1            ((USART_TypeDef *)USART1_BASE)
 #define USART2            ((USART_TypeDef *)USART2_BASE)
 #define USART6            ((USART_TypeDef *)USART6_BASE)
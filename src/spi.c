@@ -1,79 +1,261 @@
 #include "spi.h"
+#include "rcc.h"
 #include <assert.h>
 
-/* SPI 클럭 설정 내부 함수 */
-static void SPI_ClockConfig(SPI_TypeDef *SPIx, SPI_Config *config, uint32_t pclk)
+/* SPI DMA 요청 매핑 (RM0383 DMA request mapping) */
+typedef struct
+{
+    DMA_TypeDef *DMAx;    /* DMA 컨트롤러 */
+    DMA_Stream TxStream;  /* 송신 스트림 */
+    DMA_Stream RxStream;  /* 수신 스트림 */
+    DMA_Channel Channel;  /* 요청 채널 */
+} SPI_DMAMap;
+
+/* SPI DMA 전송 종류 */
+typedef enum
+{
+    SPI_DMA_FULL_DUPLEX = 0, /* 송수신 */
+    SPI_DMA_TX_ONLY,         /* 송신 전용 */
+    SPI_DMA_RX_ONLY,         /* 수신 전용 (더미 송신) */
+    SPI_DMA_RX_SIMPLEX,      /* 수신 전용/반이중 수신 (송신 스트림 없이 SPE로 클럭 생성) */
+    SPI_DMA_STREAM,          /* 순환 연속 수신 (더미 송신) */
+    SPI_DMA_SLAVE,           /* 슬레이브 순환 수신 링 + 응답 송신 */
+    SPI_DMA_FILL             /* 같은 값 반복 송신 (메모리 주소 고정, 65535 프레임 단위 재설정) */
+} SPI_DMAXfer;
+
+/* SPI DMA 전송 상태 */
+typedef struct
+{
+    SPI_DMACallback Callback; /* 전송 완료 콜백 */
+    SPI_StreamCallback StreamCallback; /* 연속 수신 콜백 */
+    uint8_t *pStream;         /* 연속 수신 버퍼 */
+    uint16_t StreamHalf;      /* 연속 수신 버퍼 절반 크기 (프레임 수) */
+    SPI_SlaveCallback SlaveCallback; /* 슬레이브 프레임 수신 콜백 */
+    uint8_t *pSlaveTx;        /* 슬레이브 응답 버퍼 (NULL이면 송신 DMA 미사용) */
+    uint16_t SlaveTxLen;      /* 슬레이브 응답 길이 (프레임 수) */
+    uint16_t RingSize;        /* 슬레이브 수신 링 크기 (프레임 수) */
+    uint16_t RingPos;         /* 슬레이브 수신 링에서 다음 프레임 시작 위치 */
+    uint16_t FillValue;       /* 채우기 값 (DMA 소스, 8비트 프레임은 하위 바이트) */
+    uint32_t FillRemaining;   /* 현재 DMA 구간 이후 남은 채우기 프레임 수 */
+    SPI_DMAXfer Xfer;         /* 전송 종류 */
+    volatile uint8_t Busy;    /* DMA 전송 진행 중 여부 */
+} SPI_DMAContext;
+
+static const SPI_DMAMap spi_dma_map[] = {
+    {DMA2, DMA_STREAM_3, DMA_STREAM_0, DMA_CHANNEL_3}, /* SPI1 */
+    {DMA1, DMA_STREAM_4, DMA_STREAM_3, DMA_CHANNEL_0}, /* SPI2 */
+    {DMA1, DMA_STREAM_5, DMA_STREAM_0, DMA_CHANNEL_0}  /* SPI3 */
+};
+
+static SPI_DMAContext spi_dma_ctx[3];
+
+/* 수신 전용 DMA에서 클럭 생성을 위해 반복 전송하는 더미 데이터 (8/16비트 프레임 공용) */
+static const uint16_t spi_dma_dummy = 0xFFFF;
+
+/* SPI 인스턴스 인덱스 반환 내부 함수 */
+static uint8_t SPI_GetIndex(SPI_TypeDef *SPIx)
+{
+    if (SPIx == SPI1)
+        return 0;
+    if (SPIx == SPI2)
+        return 1;
+    return 2;
+}
+
+/* 수신 데이터 및 OVR 플래그 정리 내부 함수 (DR 읽기 후 SR 읽기) */
+static void SPI_ClearOverrun(SPI_TypeDef *SPIx)
+{
+    (void)SPIx->DR;
+    (void)SPIx->SR.w;
+}
+
+/* CRC 전송 시작 내부 함수 - CRC가 활성화된 경우 계산 값 초기화 */
+static void SPI_CRCStart(SPI_TypeDef *SPIx)
+{
+    if (SPIx->CR1.b.CRCEN)
+    {
+        SPI_ResetCRC(SPIx);
+    }
+}
+
+/* 수신 CRC 검사 내부 함수 - CRCERR를 지우고 결과 반환 */
+static SPI_Status SPI_CRCCheck(SPI_TypeDef *SPIx)
+{
+    if (SPIx->SR.b.CRCERR)
+    {
+        SPIx->SR.b.CRCERR = 0;
+        return SPI_CRC_ERROR;
+    }
+
+    return SPI_OK;
+}
+
+/* 마지막 프레임 전송 완료 대기 내부 함수 (TXE=1, BSY=0) */
+static SPI_Status SPI_WaitIdle(SPI_TypeDef *SPIx)
+{
+    uint32_t timeout = SPI_TIMEOUT_DEFAULT;
+
+    while (!SPIx->SR.b.TXE || SPIx->SR.b.BSY)
+    {
+        if (--timeout == 0)
+        {
+            return SPI_TIMEOUT;
+        }
+    }
+
+    return SPI_OK;
+}
+
+/* 단방향 수신 모드(RXONLY 또는 BIDIMODE) 여부 반환 내부 함수 */
+static uint8_t SPI_IsRxSimplex(SPI_TypeDef *SPIx)
+{
+    return SPIx->CR1.b.RXONLY || SPIx->CR1.b.BIDIMODE;
+}
+
+/* 단방향 수신 클럭 시작 내부 함수 - 마스터는 SPE=1(반이중은 BIDIOE=0) 즉시 클럭을 연속 생성 */
+static void SPI_RxSimplexStart(SPI_TypeDef *SPIx)
+{
+    SPIx->CR1.b.SPE = 0;
+    SPI_ClearOverrun(SPIx);
+    if (SPIx->CR1.b.BIDIMODE)
+    {
+        SPIx->CR1.b.BIDIOE = 0;
+    }
+    SPIx->CR1.b.SPE = 1;
+}
+
+/* 단방향 수신 클럭 정지 내부 함수 - 반이중은 송신 방향(클럭 없음)으로 복귀 */
+static void SPI_RxSimplexStop(SPI_TypeDef *SPIx)
+{
+    SPIx->CR1.b.SPE = 0;
+    if (SPIx->CR1.b.BIDIMODE)
+    {
+        SPIx->CR1.b.BIDIOE = 1;
+        SPIx->CR1.b.SPE = 1;
+    }
+}
+
+/* SPI 인스턴스가 연결된 APB 버스 클럭 반환 내부 함수 (SPI1: APB2, SPI2/3: APB1) */
+static uint32_t SPI_GetPCLK(SPI_TypeDef *SPIx)
+{
+    return (SPIx == SPI1) ? RCC_GetPCLK2() : RCC_GetPCLK1();
+}
+
+/* SPI 클럭 설정 내부 함수 - 요청 속도를 넘지 않는 가장 빠른 분주비 선택 */
+static void SPI_ClockConfig(SPI_CR1_TypeDef *cr1, SPI_Config *config, uint32_t pclk)
 {
     /* 널 포인터 체크 */
-    assert(SPIx != NULL);
+    assert(cr1 != NULL);
     assert(config != NULL);
+    /* 클럭 속도 체크 */
+    assert(config->ClockSpeed > 0);
 
-    uint32_t br_div;
-
-    /* 클럭 분주비 설정 */
-    br_div = pclk / config->ClockSpeed;
-    if (br_div >= 256)
-        SPIx->CR1.b.BR = 7; // PCLK/256
-    else if (br_div >= 128)
-        SPIx->CR1.b.BR = 6; // PCLK/128
-    else if (br_div >= 64)
-        SPIx->CR1.b.BR = 5; // PCLK/64
-    else if (br_div >= 32)
-        SPIx->CR1.b.BR = 4; // PCLK/32
-    else if (br_div >= 16)
-        SPIx->CR1.b.BR = 3; // PCLK/16
-    else if (br_div >= 8)
-        SPIx->CR1.b.BR = 2; // PCLK/8
-    else if (br_div >= 4)
-        SPIx->CR1.b.BR = 1; // PCLK/4
-    else
-        SPIx->CR1.b.BR = 0; // PCLK/2
+    uint8_t br = 0;
+
+    /* SCK = PCLK / 2^(BR+1), 요청보다 느린 속도가 없으면 PCLK/256 */
+    while (br < 7 && (pclk >> (br + 1)) > config->ClockSpeed)
+    {
+        br++;
+    }
+
+    cr1->b.BR = br;
 }
 
 /* SPI 모드 설정 내부 함수 */
-static void SPI_ModeConfig(SPI_TypeDef *SPIx, SPI_Config *config)
+static void SPI_ModeConfig(SPI_CR1_TypeDef *cr1, SPI_CR2_TypeDef *cr2, SPI_Config *config)
 {
     /* 널 포인터 체크 */
-    assert(SPIx != NULL);
+    assert(cr1 != NULL);
+    assert(cr2 != NULL);
     assert(config != NULL);
 
     /* SPI 모드 설정 */
     switch (config->Mode)
     {
     case SPI_MODE_0:
-        SPIx->CR1.b.CPOL = 0;
-        SPIx->CR1.b.CPHA = 0;
+        cr1->b.CPOL = 0;
+        cr1->b.CPHA = 0;
         break;
     case SPI_MODE_1:
-        SPIx->CR1.b.CPOL = 0;
-        SPIx->CR1.b.CPHA = 1;
+        cr1->b.CPOL = 0;
+        cr1->b.CPHA = 1;
         break;
     case SPI_MODE_2:
-        SPIx->CR1.b.CPOL = 1;
-        SPIx->CR1.b.CPHA = 0;
+        cr1->b.CPOL = 1;
+        cr1->b.CPHA = 0;
         break;
     case SPI_MODE_3:
-        SPIx->CR1.b.CPOL = 1;
-        SPIx->CR1.b.CPHA = 1;
+        cr1->b.CPOL = 1;
+        cr1->b.CPHA = 1;
         break;
     }
 
     /* 데이터 크기 설정 */
-    SPIx->CR1.b.DFF = config->DataSize;
+    cr1->b.DFF = config->DataSize;
 
     /* 첫 비트 전송 순서 설정 */
-    SPIx->CR1.b.LSBFIRST = config->FirstBit;
+    cr1->b.LSBFIRST = config->FirstBit;
+
+    /* 데이터 라인 방향 설정 */
+    switch (config->Direction)
+    {
+    case SPI_DIRECTION_2LINES_RXONLY:
+        cr1->b.RXONLY = 1;
+        break;
+    case SPI_DIRECTION_1LINE:
+        cr1->b.BIDIMODE = 1;
+        cr1->b.BIDIOE = config->Slave ? 0 : 1; // 마스터는 송신 방향(클럭 없음)에서 대기
+        break;
+    default:
+        break;
+    }
 
     /* NSS 핀 관리 방식 설정 */
     if (config->NSS)
     {
-        SPIx->CR1.b.SSM = 1; // 소프트웨어 NSS 관리
-        SPIx->CR1.b.SSI = 1; // 내부 슬레이브 선택 신호를 High로 설정
+        cr1->b.SSM = 1; // 소프트웨어 NSS 관리
+        cr1->b.SSI = config->Slave ? 0 : 1; // 마스터: High(MODF 방지), 슬레이브: Low(항상 선택됨)
     }
-    else
+    else if (!config->Slave)
+    {
+        cr2->b.SSOE = 1; // 하드웨어 NSS 출력 활성화
+    }
+    /* 슬레이브 하드웨어 NSS: SSM=0, NSS 핀 입력으로 선택 */
+}
+
+/* 설정 레지스터 값 계산 */
+void SPI_BuildConfig(SPI_TypeDef *SPIx, SPI_Config *config, uint32_t *cr1, uint32_t *cr2)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(config != NULL);
+    assert(cr1 != NULL);
+    assert(cr2 != NULL);
+
+    uint32_t pclk = SPI_GetPCLK(SPIx); // 인스턴스가 연결된 APB 클럭 주파수
+    SPI_CR1_TypeDef cr1_val = {.w = 0};
+    SPI_CR2_TypeDef cr2_val = {.w = 0};
+
+    /* 마스터/슬레이브 모드 설정 */
+    cr1_val.b.MSTR = config->Slave ? 0 : 1;
+
+    /* SPI 클럭 설정 (슬레이브는 마스터의 SCK를 사용하므로 BR 무시) */
+    if (!config->Slave)
     {
-        SPIx->CR2.b.SSOE = 1; // 하드웨어 NSS 출력 활성화
+        SPI_ClockConfig(&cr1_val, config, pclk);
     }
+
+    /* SPI 모드 및 기타 설정 */
+    SPI_ModeConfig(&cr1_val, &cr2_val, config);
+
+    /* 하드웨어 CRC 설정 */
+    cr1_val.b.CRCEN = config->CRCEnable ? 1 : 0;
+
+    /* SPI 활성화 상태로 저장 (수신 전용 마스터는 SPE=1이면 클럭이 바로 나가므로 읽을 때만 활성화) */
+    cr1_val.b.SPE = (config->Direction == SPI_DIRECTION_2LINES_RXONLY && !config->Slave) ? 0 : 1;
+
+    *cr1 = cr1_val.w;
+    *cr2 = cr2_val.w;
 }
 
 /* SPI 초기화 함수 */
@@ -83,7 +265,9 @@ void SPI_Init(SPI_TypeDef *SPIx, SPI_Config *config)
     assert(SPIx != NULL);
     assert(config != NULL);
 
-    uint32_t pclk = SYSTEM_CLOCK_DEFAULT; // PCLK 클럭 주파수
+    SPI_CR1_TypeDef cr1;
+    uint32_t cr2;
+    uint8_t spe;
 
     /* SPI 클럭 활성화 */
     if (SPIx == SPI1)
@@ -99,24 +283,19 @@ void SPI_Init(SPI_TypeDef *SPIx, SPI_Config *config)
         RCC->APB1ENR.b.SPI3EN = 1;
     }
 
+    /* 레지스터 값 계산 */
+    SPI_BuildConfig(SPIx, config, &cr1.w, &cr2);
+
     /* SPI 비활성화 */
     SPIx->CR1.b.SPE = 0;
 
-    /* SPI 설정 초기화 */
-    SPIx->CR1.w = 0;
-    SPIx->CR2.w = 0;
-
-    /* 마스터 모드 설정 */
-    SPIx->CR1.b.MSTR = 1;
-
-    /* SPI 클럭 설정 */
-    SPI_ClockConfig(SPIx, config, pclk);
-
-    /* SPI 모드 및 기타 설정 */
-    SPI_ModeConfig(SPIx, config);
-
-    /* SPI 활성화 */
-    SPIx->CR1.b.SPE = 1;
+    /* SPI 설정 (SPE=0 상태에서 설정 후 활성화) */
+    SPIx->CRCPR = config->CRCPolynomial ? config->CRCPolynomial : SPI_CRC_POLYNOMIAL_DEFAULT;
+    SPIx->CR2.w = cr2;
+    spe = cr1.b.SPE;
+    cr1.b.SPE = 0;
+    SPIx->CR1.w = cr1.w;
+    SPIx->CR1.b.SPE = spe;
 }
 
 /* SPI 비활성화 함수 */
@@ -143,6 +322,95 @@ void SPI_DeInit(SPI_TypeDef *SPIx)
     }
 }
 
+/* 실제 SCK 주파수 */
+uint32_t SPI_GetClock(SPI_TypeDef *SPIx)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+
+    return SPI_GetPCLK(SPIx) >> (SPIx->CR1.b.BR + 1);
+}
+
+/* 클럭 변경 후 분주비 재계산 */
+uint32_t SPI_UpdateClock(SPI_TypeDef *SPIx, SPI_Config *config)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(config != NULL);
+
+    SPI_CR1_TypeDef cr1 = {.w = SPIx->CR1.w};
+    uint8_t spe = cr1.b.SPE;
+
+    SPI_ClockConfig(&cr1, config, SPI_GetPCLK(SPIx));
+
+    /* BR은 SPE=0 상태에서만 변경 - 분주비가 같으면 레지스터를 쓰지 않음 */
+    if (cr1.b.BR != SPIx->CR1.b.BR)
+    {
+        SPIx->CR1.b.SPE = 0;
+        cr1.b.SPE = 0;
+        SPIx->CR1.w = cr1.w;
+        SPIx->CR1.b.SPE = spe;
+    }
+
+    return SPI_GetClock(SPIx);
+}
+
+/* 단방향 수신 내부 함수 - 더미 송신 없이 연속 클럭으로 수신하고 마지막 프레임 중에 클럭 정지 */
+static SPI_Status SPI_ReceiveFrames(SPI_TypeDef *SPIx, void *rxData, uint16_t len, uint8_t frame16)
+{
+    uint8_t *rx8 = (uint8_t *)rxData;
+    uint16_t *rx16 = (uint16_t *)rxData;
+    /* SCK 1주기 이상 대기할 루프 횟수 (루프 1회 약 4 HCLK 사이클) */
+    uint32_t sck_wait = RCC_GetHCLK() / SPI_GetClock(SPIx) / 4 + 1;
+    volatile uint32_t wait;
+    uint32_t timeout;
+    SPI_Status status = SPI_OK;
+
+    /* 클럭은 마스터만 생성, 수신 전용 경로는 하드웨어 CRC 미지원 */
+    if (!SPIx->CR1.b.MSTR || SPIx->CR1.b.CRCEN)
+    {
+        return SPI_ERROR;
+    }
+
+    SPI_RxSimplexStart(SPIx);
+
+    while (len--)
+    {
+        /* n-1번째 프레임 수신 후(1프레임이면 시작 직후) SCK 1주기 뒤 SPE=0 - 진행 중인 마지막 프레임까지만 수신 */
+        if (len == 0)
+        {
+            for (wait = sck_wait; wait > 0; wait--);
+            SPIx->CR1.b.SPE = 0;
+        }
+
+        timeout = SPI_TIMEOUT_DEFAULT;
+        while (!SPIx->SR.b.RXNE)
+        {
+            if (--timeout == 0)
+            {
+                status = SPI_TIMEOUT;
+                break;
+            }
+        }
+        if (status != SPI_OK)
+        {
+            break;
+        }
+
+        if (frame16)
+            *rx16++ = (uint16_t)SPIx->DR;
+        else
+            *rx8++ = (uint8_t)SPIx->DR;
+    }
+
+    SPI_RxSimplexStop(SPIx);
+
+    /* 정지가 늦어 추가로 수신된 프레임 정리 */
+    SPI_ClearOverrun(SPIx);
+
+    return status;
+}
+
 /* 1바이트 데이터 쓰기 */
 SPI_Status SPI_WriteByte(SPI_TypeDef *SPIx, uint8_t data)
 {
@@ -151,6 +419,12 @@ SPI_Status SPI_WriteByte(SPI_TypeDef *SPIx, uint8_t data)
 
     uint32_t timeout = SPI_TIMEOUT_DEFAULT;
 
+    /* 수신 전용 모드에서는 송신 불가 */
+    if (SPIx->CR1.b.RXONLY)
+    {
+        return SPI_ERROR;
+    }
+
     /* TXE 플래그 대기 */
     while (!SPIx->SR.b.TXE)
     {
@@ -173,6 +447,9 @@ SPI_Status SPI_WriteByte(SPI_TypeDef *SPIx, uint8_t data)
         }
     }
 
+    /* 함께 수신된 데이터는 버려 OVR이 쌓이지 않도록 함 */
+    SPI_ClearOverrun(SPIx);
+
     return SPI_OK;
 }
 
@@ -185,6 +462,12 @@ SPI_Status SPI_ReadByte(SPI_TypeDef *SPIx, uint8_t *data)
 
     uint32_t timeout = SPI_TIMEOUT_DEFAULT;
 
+    /* 수신 전용/반이중은 더미 송신 없이 수신 */
+    if (SPI_IsRxSimplex(SPIx))
+    {
+        return SPI_ReceiveFrames(SPIx, data, 1, 0);
+    }
+
     /* 더미 데이터 전송으로 클럭 생성 */
     SPIx->DR = 0xFF;
 
@@ -203,60 +486,80 @@ SPI_Status SPI_ReadByte(SPI_TypeDef *SPIx, uint8_t *data)
     return SPI_OK;
 }
 
-/* 여러 바이트 데이터 쓰기 */
-SPI_Status SPI_WriteData(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len)
+/* 연속 쓰기 내부 함수 (frame16: 0이면 uint8_t 버퍼, 1이면 uint16_t 버퍼) */
+static SPI_Status SPI_WriteFrames(SPI_TypeDef *SPIx, const void *data, uint16_t len, uint8_t frame16)
 {
-    /* 널 포인터 체크 */
-    assert(SPIx != NULL);
-    assert(data != NULL);
-    /* 데이터 길이 체크 */
-    assert(len > 0);
-
+    const uint8_t *data8 = (const uint8_t *)data;
+    const uint16_t *data16 = (const uint16_t *)data;
+    uint8_t crc = SPIx->CR1.b.CRCEN;
     SPI_Status status;
+    uint32_t timeout;
 
-    while (len--)
+    /* 수신 전용 모드에서는 송신 불가 (반이중은 BIDIOE=1 송신 방향에서 대기 중이므로 그대로 전송) */
+    if (SPIx->CR1.b.RXONLY)
     {
-        status = SPI_WriteByte(SPIx, *data++);
-        if (status != SPI_OK)
-            return status;
+        return SPI_ERROR;
     }
 
-    return SPI_OK;
-}
-
-/* 여러 바이트 데이터 읽기 */
-SPI_Status SPI_ReadData(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len)
-{
-    /* 널 포인터 체크 */
-    assert(SPIx != NULL);
-    assert(data != NULL);
-    /* 데이터 길이 체크 */
-    assert(len > 0);
-
-    SPI_Status status;
+    SPI_CRCStart(SPIx);
 
     while (len--)
     {
-        status = SPI_ReadByte(SPIx, data++);
-        if (status != SPI_OK)
-            return status;
+        /* TXE마다 DR을 채워 프레임 사이 공백 없이 전송 - BSY는 마지막에 한 번만 확인 */
+        timeout = SPI_TIMEOUT_DEFAULT;
+        while (!SPIx->SR.b.TXE)
+        {
+            if (--timeout == 0)
+            {
+                return SPI_TIMEOUT;
+            }
+        }
+
+        SPIx->DR = frame16 ? *data16++ : *data8++;
+
+        /* 마지막 데이터 직후 CRC 송신 요청 */
+        if (len == 0 && crc)
+        {
+            SPIx->CR1.b.CRCNEXT = 1;
+        }
+
+        /* 수신 데이터는 사용하지 않으므로 도착하는 대로 버림 */
+        if (SPIx->SR.b.RXNE)
+        {
+            (void)SPIx->DR;
+        }
     }
 
-    return SPI_OK;
+    /* 마지막 프레임 전송 완료 대기 */
+    status = SPI_WaitIdle(SPIx);
+
+    /* 마지막 수신 데이터 및 OVR 정리 (DR 적재 중 RXNE를 놓친 경우 포함) */
+    SPI_ClearOverrun(SPIx);
+
+    /* 송신 전용이므로 수신 CRC 결과는 의미 없음 */
+    (void)SPI_CRCCheck(SPIx);
+
+    return status;
 }
 
-/* 데이터 동시 송수신 */
-SPI_Status SPI_TransferData(SPI_TypeDef *SPIx, uint8_t *txData, uint8_t *rxData, uint16_t len)
+/* 동시 송수신 내부 함수 (txData가 NULL이면 더미 0xFFFF 송신, frame16은 SPI_WriteFrames와 동일) */
+static SPI_Status SPI_TransferFrames(SPI_TypeDef *SPIx, const void *txData, void *rxData, uint16_t len, uint8_t frame16)
 {
-    /* 널 포인터 체크 */
-    assert(SPIx != NULL);
-    assert(txData != NULL);
-    assert(rxData != NULL);
-    /* 데이터 길이 체크 */
-    assert(len > 0);
-
+    const uint8_t *tx8 = (const uint8_t *)txData;
+    const uint16_t *tx16 = (const uint16_t *)txData;
+    uint8_t *rx8 = (uint8_t *)rxData;
+    uint16_t *rx16 = (uint16_t *)rxData;
+    uint8_t crc = SPIx->CR1.b.CRCEN;
     uint32_t timeout;
 
+    /* 수신 전용/반이중: 읽기는 더미 송신 없이 수신, 동시 송수신은 불가 */
+    if (SPI_IsRxSimplex(SPIx))
+    {
+        return (txData == NULL) ? SPI_ReceiveFrames(SPIx, rxData, len, frame16) : SPI_ERROR;
+    }
+
+    SPI_CRCStart(SPIx);
+
     while (len--)
     {
         /* TXE 플래그 대기 */
@@ -270,7 +573,16 @@ SPI_Status SPI_TransferData(SPI_TypeDef *SPIx, uint8_t *txData, uint8_t *rxData,
         }
 
         /* 데이터 전송 */
-        SPIx->DR = *txData++;
+        if (txData == NULL)
+            SPIx->DR = 0xFFFF;
+        else
+            SPIx->DR = frame16 ? *tx16++ : *tx8++;
+
+        /* 마지막 데이터 직후 CRC 송신 요청 */
+        if (len == 0 && crc)
+        {
+            SPIx->CR1.b.CRCNEXT = 1;
+        }
 
         /* RXNE 플래그 대기 */
         timeout = SPI_TIMEOUT_DEFAULT;
@@ -283,7 +595,24 @@ SPI_Status SPI_TransferData(SPI_TypeDef *SPIx, uint8_t *txData, uint8_t *rxData,
         }
 
         /* 데이터 읽기 */
-        *rxData++ = SPIx->DR;
+        if (frame16)
+            *rx16++ = (uint16_t)SPIx->DR;
+        else
+            *rx8++ = (uint8_t)SPIx->DR;
+    }
+
+    /* 수신된 CRC 프레임 읽기 (비교는 하드웨어가 수행) */
+    if (crc)
+    {
+        timeout = SPI_TIMEOUT_DEFAULT;
+        while (!SPIx->SR.b.RXNE)
+        {
+            if (--timeout == 0)
+            {
+                return SPI_TIMEOUT;
+            }
+        }
+        (void)SPIx->DR;
     }
 
     /* BSY 플래그 대기 */
@@ -296,17 +625,1004 @@ SPI_Status SPI_TransferData(SPI_TypeDef *SPIx, uint8_t *txData, uint8_t *rxData,
         }
     }
 
-    return SPI_OK;
+    return crc ? SPI_CRCCheck(SPIx) : SPI_OK;
 }
 
-/* NSS 핀 제어 */
-void SPI_SetNSS(SPI_TypeDef *SPIx, uint8_t state)
+/* 여러 바이트 데이터 쓰기 */
+SPI_Status SPI_WriteData(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len)
 {
     /* 널 포인터 체크 */
     assert(SPIx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
 
-    if (SPIx->CR1.b.SSM)
-    {
-        SPIx->CR1.b.SSI = state;
-    }
-}
\ No newline at end of file
+    return SPI_WriteFrames(SPIx, data, len, 0);
+}
+
+/* 여러 바이트 데이터 읽기 */
+SPI_Status SPI_ReadData(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return SPI_TransferFrames(SPIx, NULL, data, len, 0);
+}
+
+/* 데이터 동시 송수신 */
+SPI_Status SPI_TransferData(SPI_TypeDef *SPIx, uint8_t *txData, uint8_t *rxData, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(txData != NULL);
+    assert(rxData != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return SPI_TransferFrames(SPIx, txData, rxData, len, 0);
+}
+
+/* 16비트 프레임 연속 쓰기 */
+SPI_Status SPI_WriteData16(SPI_TypeDef *SPIx, uint16_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    /* 16비트 프레임(DFF=1) 체크 */
+    if (!SPIx->CR1.b.DFF)
+    {
+        return SPI_ERROR;
+    }
+
+    return SPI_WriteFrames(SPIx, data, len, 1);
+}
+
+/* 16비트 프레임 읽기 */
+SPI_Status SPI_ReadData16(SPI_TypeDef *SPIx, uint16_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    /* 16비트 프레임(DFF=1) 체크 */
+    if (!SPIx->CR1.b.DFF)
+    {
+        return SPI_ERROR;
+    }
+
+    return SPI_TransferFrames(SPIx, NULL, data, len, 1);
+}
+
+/* 16비트 프레임 동시 송수신 */
+SPI_Status SPI_TransferData16(SPI_TypeDef *SPIx, uint16_t *txData, uint16_t *rxData, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(txData != NULL);
+    assert(rxData != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    /* 16비트 프레임(DFF=1) 체크 */
+    if (!SPIx->CR1.b.DFF)
+    {
+        return SPI_ERROR;
+    }
+
+    return SPI_TransferFrames(SPIx, txData, rxData, len, 1);
+}
+
+/* SPI DMA 스트림 설정 내부 함수 */
+static void SPI_DMAConfig(SPI_TypeDef *SPIx, DMA_Stream stream, DMA_Direction direction, const void *data, uint16_t len, DMA_Increment memInc, DMA_DataSize size, DMA_Mode mode)
+{
+    const SPI_DMAMap *map = &spi_dma_map[SPI_GetIndex(SPIx)];
+    DMA_Config dma_config = {
+        .Channel = map->Channel,
+        .Direction = direction,
+        .MemInc = memInc,
+        .PeriphInc = DMA_INCREMENT_DISABLE,
+        .MemDataSize = size,
+        .PeriphDataSize = size,
+        .Mode = mode,
+        .Priority = DMA_PRIORITY_HIGH,
+        .FIFOMode = 0,
+        .FIFOThreshold = DMA_FIFO_THRESHOLD_1_4,
+        .MemBurst = DMA_BURST_SINGLE,
+        .PeriphBurst = DMA_BURST_SINGLE
+    };
+
+    DMA_Init(map->DMAx, stream, &dma_config);
+
+    if (direction == DMA_DIR_MEMORY_TO_PERIPH)
+    {
+        DMA_ConfigTransfer(map->DMAx, stream, (uint32_t)data, (uint32_t)&SPIx->DR, len);
+    }
+    else
+    {
+        DMA_ConfigTransfer(map->DMAx, stream, (uint32_t)&SPIx->DR, (uint32_t)data, len);
+    }
+}
+
+/* SPI DMA 전송 시작 내부 함수 (len은 프레임 수, size는 프레임 크기) */
+static SPI_Status SPI_DMAStart(SPI_TypeDef *SPIx, const void *txData, void *rxData, uint16_t len, SPI_DMAXfer xfer, DMA_DataSize size, SPI_DMACallback callback)
+{
+    SPI_DMAContext *ctx = &spi_dma_ctx[SPI_GetIndex(SPIx)];
+    const SPI_DMAMap *map = &spi_dma_map[SPI_GetIndex(SPIx)];
+
+    if (ctx->Busy)
+    {
+        return SPI_BUSY;
+    }
+
+    /* 수신 전용/반이중: 읽기는 송신 스트림 없이 수신, 수신 전용 모드의 송신과 동시 송수신은 불가 */
+    if (SPI_IsRxSimplex(SPIx))
+    {
+        if (xfer == SPI_DMA_FULL_DUPLEX || (xfer == SPI_DMA_TX_ONLY && SPIx->CR1.b.RXONLY))
+        {
+            return SPI_ERROR;
+        }
+        if (xfer == SPI_DMA_RX_ONLY)
+        {
+            if (!SPIx->CR1.b.MSTR || SPIx->CR1.b.CRCEN)
+            {
+                return SPI_ERROR;
+            }
+            xfer = SPI_DMA_RX_SIMPLEX;
+        }
+    }
+
+    ctx->Callback = callback;
+    ctx->Xfer = xfer;
+    ctx->Busy = 1;
+
+    /* CRC는 TX 스트림이 끝나면 하드웨어가 자동으로 송신 (CRCNEXT 불필요) */
+    SPI_CRCStart(SPIx);
+
+    /* 이전 전송에서 남은 수신 데이터와 OVR 정리 */
+    SPI_ClearOverrun(SPIx);
+
+    /* RM 권장 순서: RXDMAEN → 스트림 활성화 → TXDMAEN */
+    if (xfer != SPI_DMA_TX_ONLY)
+    {
+        SPI_DMAConfig(SPIx, map->RxStream, DMA_DIR_PERIPH_TO_MEMORY, rxData, len, DMA_INCREMENT_ENABLE, size, DMA_MODE_NORMAL);
+        DMA_EnableInterrupts(map->DMAx, map->RxStream, 1, 0, 1, 0);
+        SPIx->CR2.b.RXDMAEN = 1;
+        DMA_Enable(map->DMAx, map->RxStream);
+    }
+
+    /* 단방향 수신: 송신 스트림 없이 클럭 시작, 완료 인터럽트에서 정지 */
+    if (xfer == SPI_DMA_RX_SIMPLEX)
+    {
+        SPI_RxSimplexStart(SPIx);
+        return SPI_OK;
+    }
+
+    if (xfer == SPI_DMA_RX_ONLY)
+    {
+        SPI_DMAConfig(SPIx, map->TxStream, DMA_DIR_MEMORY_TO_PERIPH, &spi_dma_dummy, len, DMA_INCREMENT_DISABLE, size, DMA_MODE_NORMAL);
+    }
+    else
+    {
+        SPI_DMAConfig(SPIx, map->TxStream, DMA_DIR_MEMORY_TO_PERIPH, txData, len, DMA_INCREMENT_ENABLE, size, DMA_MODE_NORMAL);
+    }
+    DMA_EnableInterrupts(map->DMAx, map->TxStream, 1, 0, 1, 0);
+    DMA_Enable(map->DMAx, map->TxStream);
+    SPIx->CR2.b.TXDMAEN = 1;
+
+    return SPI_OK;
+}
+
+/* DMA 송수신 */
+SPI_Status SPI_TransferData_DMA(SPI_TypeDef *SPIx, uint8_t *txData, uint8_t *rxData, uint16_t len, SPI_DMACallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(txData != NULL);
+    assert(rxData != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return SPI_DMAStart(SPIx, txData, rxData, len, SPI_DMA_FULL_DUPLEX, DMA_SIZE_BYTE, callback);
+}
+
+/* DMA 송신 전용 */
+SPI_Status SPI_WriteData_DMA(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len, SPI_DMACallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return SPI_DMAStart(SPIx, data, NULL, len, SPI_DMA_TX_ONLY, DMA_SIZE_BYTE, callback);
+}
+
+/* DMA 수신 전용 */
+SPI_Status SPI_ReadData_DMA(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len, SPI_DMACallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return SPI_DMAStart(SPIx, NULL, data, len, SPI_DMA_RX_ONLY, DMA_SIZE_BYTE, callback);
+}
+
+/* 16비트 프레임 DMA 송수신 */
+SPI_Status SPI_TransferData16_DMA(SPI_TypeDef *SPIx, uint16_t *txData, uint16_t *rxData, uint16_t len, SPI_DMACallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(txData != NULL);
+    assert(rxData != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    /* 16비트 프레임(DFF=1) 체크 */
+    if (!SPIx->CR1.b.DFF)
+    {
+        return SPI_ERROR;
+    }
+
+    return SPI_DMAStart(SPIx, txData, rxData, len, SPI_DMA_FULL_DUPLEX, DMA_SIZE_HALF_WORD, callback);
+}
+
+/* 16비트 프레임 DMA 송신 전용 */
+SPI_Status SPI_WriteData16_DMA(SPI_TypeDef *SPIx, uint16_t *data, uint16_t len, SPI_DMACallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    /* 16비트 프레임(DFF=1) 체크 */
+    if (!SPIx->CR1.b.DFF)
+    {
+        return SPI_ERROR;
+    }
+
+    return SPI_DMAStart(SPIx, data, NULL, len, SPI_DMA_TX_ONLY, DMA_SIZE_HALF_WORD, callback);
+}
+
+/* 16비트 프레임 DMA 수신 전용 */
+SPI_Status SPI_ReadData16_DMA(SPI_TypeDef *SPIx, uint16_t *data, uint16_t len, SPI_DMACallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    /* 16비트 프레임(DFF=1) 체크 */
+    if (!SPIx->CR1.b.DFF)
+    {
+        return SPI_ERROR;
+    }
+
+    return SPI_DMAStart(SPIx, NULL, data, len, SPI_DMA_RX_ONLY, DMA_SIZE_HALF_WORD, callback);
+}
+
+/* 같은 값 반복 DMA 송신 */
+SPI_Status SPI_Fill_DMA(SPI_TypeDef *SPIx, uint16_t value, uint32_t count, SPI_DMACallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    /* 데이터 길이 체크 */
+    assert(count > 0);
+
+    SPI_DMAContext *ctx = &spi_dma_ctx[SPI_GetIndex(SPIx)];
+    const SPI_DMAMap *map = &spi_dma_map[SPI_GetIndex(SPIx)];
+    DMA_DataSize size = SPIx->CR1.b.DFF ? DMA_SIZE_HALF_WORD : DMA_SIZE_BYTE;
+    uint16_t chunk = (count > 0xFFFF) ? 0xFFFF : (uint16_t)count;
+
+    if (ctx->Busy)
+    {
+        return SPI_BUSY;
+    }
+
+    /* 수신 전용 모드는 송신 불가, CRC는 DMA 구간마다 자동 송신되므로 미지원 */
+    if (SPIx->CR1.b.RXONLY || SPIx->CR1.b.CRCEN)
+    {
+        return SPI_ERROR;
+    }
+
+    ctx->FillValue = value;
+    ctx->FillRemaining = count - chunk;
+    ctx->Callback = callback;
+    ctx->Xfer = SPI_DMA_FILL;
+    ctx->Busy = 1;
+
+    SPI_ClearOverrun(SPIx);
+
+    /* TX: 메모리 주소 증가 없이 FillValue 하나를 반복 전송 */
+    SPI_DMAConfig(SPIx, map->TxStream, DMA_DIR_MEMORY_TO_PERIPH, &ctx->FillValue, chunk, DMA_INCREMENT_DISABLE, size, DMA_MODE_NORMAL);
+    DMA_EnableInterrupts(map->DMAx, map->TxStream, 1, 0, 1, 0);
+    DMA_Enable(map->DMAx, map->TxStream);
+    SPIx->CR2.b.TXDMAEN = 1;
+
+    return SPI_OK;
+}
+
+/* 순환 DMA 연속 수신 시작 */
+SPI_Status SPI_ReadStream_DMA(SPI_TypeDef *SPIx, uint8_t *buffer, uint16_t len, SPI_StreamCallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(buffer != NULL);
+    assert(callback != NULL);
+    /* 데이터 길이 체크 (두 절반으로 나눌 수 있어야 함) */
+    assert(len >= 2 && (len % 2) == 0);
+
+    SPI_DMAContext *ctx = &spi_dma_ctx[SPI_GetIndex(SPIx)];
+    const SPI_DMAMap *map = &spi_dma_map[SPI_GetIndex(SPIx)];
+    DMA_DataSize size = SPIx->CR1.b.DFF ? DMA_SIZE_HALF_WORD : DMA_SIZE_BYTE;
+
+    if (ctx->Busy)
+    {
+        return SPI_BUSY;
+    }
+
+    /* 단방향 수신 클럭은 마스터만 생성 */
+    if (SPI_IsRxSimplex(SPIx) && !SPIx->CR1.b.MSTR)
+    {
+        return SPI_ERROR;
+    }
+
+    ctx->Callback = NULL;
+    ctx->StreamCallback = callback;
+    ctx->pStream = buffer;
+    ctx->StreamHalf = len / 2;
+    ctx->Xfer = SPI_DMA_STREAM;
+    ctx->Busy = 1;
+
+    SPI_ClearOverrun(SPIx);
+
+    /* RX: 순환 모드, 절반/완료 인터럽트로 핑퐁 */
+    SPI_DMAConfig(SPIx, map->RxStream, DMA_DIR_PERIPH_TO_MEMORY, buffer, len, DMA_INCREMENT_ENABLE, size, DMA_MODE_CIRCULAR);
+    DMA_EnableInterrupts(map->DMAx, map->RxStream, 1, 1, 1, 0);
+    SPIx->CR2.b.RXDMAEN = 1;
+    DMA_Enable(map->DMAx, map->RxStream);
+
+    /* 수신 전용/반이중: 더미 송신 없이 SPE로 클럭을 연속 생성 */
+    if (SPI_IsRxSimplex(SPIx))
+    {
+        SPI_RxSimplexStart(SPIx);
+        return SPI_OK;
+    }
+
+    /* TX: 순환 모드 더미 송신, 오류 인터럽트만 사용 */
+    SPI_DMAConfig(SPIx, map->TxStream, DMA_DIR_MEMORY_TO_PERIPH, &spi_dma_dummy, len, DMA_INCREMENT_DISABLE, size, DMA_MODE_CIRCULAR);
+    DMA_EnableInterrupts(map->DMAx, map->TxStream, 0, 0, 1, 0);
+    DMA_Enable(map->DMAx, map->TxStream);
+    SPIx->CR2.b.TXDMAEN = 1;
+
+    return SPI_OK;
+}
+
+/* 순환 DMA 연속 수신 중단 */
+void SPI_StopStream_DMA(SPI_TypeDef *SPIx)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+
+    SPI_DMAContext *ctx = &spi_dma_ctx[SPI_GetIndex(SPIx)];
+    const SPI_DMAMap *map = &spi_dma_map[SPI_GetIndex(SPIx)];
+
+    if (!ctx->Busy || ctx->Xfer != SPI_DMA_STREAM)
+    {
+        return;
+    }
+
+    if (SPI_IsRxSimplex(SPIx))
+    {
+        /* 단방향 수신은 SPE=0으로 클럭 정지 (진행 중인 프레임은 완료됨) */
+        SPI_RxSimplexStop(SPIx);
+    }
+    else
+    {
+        /* 더미 송신을 먼저 멈춰 클럭 생성 중단 */
+        SPIx->CR2.b.TXDMAEN = 0;
+        DMA_DisableInterrupts(map->DMAx, map->TxStream);
+        DMA_Disable(map->DMAx, map->TxStream);
+        DMA_ClearFlags(map->DMAx, map->TxStream);
+
+        /* 이미 DR/시프트 레지스터에 있는 프레임이 끝난 뒤 수신 측 정리 */
+        (void)SPI_WaitIdle(SPIx);
+    }
+
+    SPIx->CR2.b.RXDMAEN = 0;
+    DMA_DisableInterrupts(map->DMAx, map->RxStream);
+    DMA_Disable(map->DMAx, map->RxStream);
+    DMA_ClearFlags(map->DMAx, map->RxStream);
+    SPI_ClearOverrun(SPIx);
+
+    ctx->Busy = 0;
+}
+
+/* 순환 DMA 연속 수신 인터럽트 처리 내부 함수 */
+static void SPI_DMAStreamIRQ(SPI_TypeDef *SPIx, SPI_DMAContext *ctx, const SPI_DMAMap *map)
+{
+    SPI_StreamCallback callback = ctx->StreamCallback;
+    uint8_t *second = ctx->pStream + ((uint32_t)ctx->StreamHalf << SPIx->CR1.b.DFF);
+    uint8_t half;
+    uint8_t full;
+
+    if ((!SPI_IsRxSimplex(SPIx) && DMA_IsTransferError(map->DMAx, map->TxStream)) || DMA_IsTransferError(map->DMAx, map->RxStream))
+    {
+        SPI_StopStream_DMA(SPIx);
+        callback(SPIx, NULL, 0, SPI_ERROR);
+        return;
+    }
+
+    half = DMA_IsHalfTransferComplete(map->DMAx, map->RxStream);
+    full = DMA_IsTransferComplete(map->DMAx, map->RxStream);
+    DMA_ClearFlags(map->DMAx, map->RxStream);
+
+    /* 처리가 늦어 두 플래그가 함께 설정된 경우에도 앞쪽 절반부터 순서대로 통지 */
+    if (half)
+    {
+        callback(SPIx, ctx->pStream, ctx->StreamHalf, SPI_OK);
+    }
+
+    /* 콜백에서 스트림을 중단했으면 더 이상 통지하지 않음 */
+    if (full && ctx->Busy)
+    {
+        callback(SPIx, second, ctx->StreamHalf, SPI_OK);
+    }
+}
+
+/* 슬레이브 응답 송신 DMA 설정 내부 함수 (응답 버퍼 처음부터) */
+static void SPI_SlaveArmTx(SPI_TypeDef *SPIx, SPI_DMAContext *ctx, const SPI_DMAMap *map)
+{
+    DMA_DataSize size = SPIx->CR1.b.DFF ? DMA_SIZE_HALF_WORD : DMA_SIZE_BYTE;
+
+    SPI_DMAConfig(SPIx, map->TxStream, DMA_DIR_MEMORY_TO_PERIPH, ctx->pSlaveTx, ctx->SlaveTxLen, DMA_INCREMENT_ENABLE, size, DMA_MODE_NORMAL);
+    DMA_EnableInterrupts(map->DMAx, map->TxStream, 0, 0, 1, 0);
+    DMA_Enable(map->DMAx, map->TxStream);
+}
+
+/* 슬레이브 송신 경로 초기화 내부 함수 - DR에 미리 적재된 데이터는 SPE로 비울 수 없으므로 주변장치 리셋 */
+static void SPI_SlaveResetTx(SPI_TypeDef *SPIx, SPI_DMAContext *ctx, const SPI_DMAMap *map)
+{
+    SPI_CR1_TypeDef cr1 = {.w = SPIx->CR1.w};
+    uint32_t cr2 = SPIx->CR2.w;
+    uint16_t crcpr = SPIx->CRCPR;
+
+    DMA_DisableInterrupts(map->DMAx, map->TxStream);
+    DMA_Disable(map->DMAx, map->TxStream);
+    DMA_ClearFlags(map->DMAx, map->TxStream);
+
+    if (SPIx == SPI1)
+    {
+        RCC->APB2RSTR |= (1 << 12);  // SPI1 리셋
+        RCC->APB2RSTR &= ~(1 << 12); // SPI1 리셋 해제
+    }
+    else if (SPIx == SPI2)
+    {
+        RCC->APB1RSTR |= (1 << 14);  // SPI2 리셋
+        RCC->APB1RSTR &= ~(1 << 14); // SPI2 리셋 해제
+    }
+    else if (SPIx == SPI3)
+    {
+        RCC->APB1RSTR |= (1 << 15);  // SPI3 리셋
+        RCC->APB1RSTR &= ~(1 << 15); // SPI3 리셋 해제
+    }
+
+    /* 설정 복원 (SPE=0 상태에서 설정 후 활성화), 수신 링 DMA는 리셋과 무관하게 계속 진행 */
+    SPIx->CRCPR = crcpr;
+    SPI_SlaveArmTx(SPIx, ctx, map);
+    SPIx->CR2.w = cr2;
+    cr1.b.SPE = 0;
+    SPIx->CR1.w = cr1.w;
+    SPIx->CR1.b.SPE = 1;
+}
+
+/* 슬레이브 DMA 시작 */
+SPI_Status SPI_Slave_Start_DMA(SPI_TypeDef *SPIx, uint8_t *ring, uint16_t ringLen, uint8_t *txData, uint16_t txLen, SPI_SlaveCallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(ring != NULL);
+    assert(callback != NULL);
+    /* 데이터 길이 체크 */
+    assert(ringLen > 0);
+    assert(txData == NULL || txLen > 0);
+
+    SPI_DMAContext *ctx = &spi_dma_ctx[SPI_GetIndex(SPIx)];
+    const SPI_DMAMap *map = &spi_dma_map[SPI_GetIndex(SPIx)];
+    DMA_DataSize size = SPIx->CR1.b.DFF ? DMA_SIZE_HALF_WORD : DMA_SIZE_BYTE;
+
+    if (SPIx->CR1.b.MSTR)
+    {
+        return SPI_ERROR;
+    }
+    if (ctx->Busy)
+    {
+        return SPI_BUSY;
+    }
+
+    ctx->Callback = NULL;
+    ctx->SlaveCallback = callback;
+    ctx->pStream = ring;
+    ctx->RingSize = ringLen;
+    ctx->RingPos = 0;
+    ctx->pSlaveTx = txData;
+    ctx->SlaveTxLen = txLen;
+    ctx->Xfer = SPI_DMA_SLAVE;
+    ctx->Busy = 1;
+
+    /* 첫 응답 프레임을 미리 적재할 수 있도록 SPE=0 상태에서 준비 */
+    SPIx->CR1.b.SPE = 0;
+    SPI_ClearOverrun(SPIx);
+
+    /* RX: 순환 링, 프레임 경계는 NSS 상승 에지에서 NDTR로 판단하므로 오류 인터럽트만 사용 */
+    SPI_DMAConfig(SPIx, map->RxStream, DMA_DIR_PERIPH_TO_MEMORY, ring, ringLen, DMA_INCREMENT_ENABLE, size, DMA_MODE_CIRCULAR);
+    DMA_EnableInterrupts(map->DMAx, map->RxStream, 0, 0, 1, 0);
+    SPIx->CR2.b.RXDMAEN = 1;
+    DMA_Enable(map->DMAx, map->RxStream);
+
+    /* TX: 응답 버퍼를 일반 모드로 적재 */
+    if (txData != NULL)
+    {
+        SPI_SlaveArmTx(SPIx, ctx, map);
+        SPIx->CR2.b.TXDMAEN = 1;
+    }
+
+    SPIx->CR1.b.SPE = 1;
+
+    return SPI_OK;
+}
+
+/* 슬레이브 응답 버퍼 변경 */
+void SPI_Slave_SetResponse(SPI_TypeDef *SPIx, uint8_t *txData, uint16_t txLen)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+    assert(txData != NULL);
+    /* 데이터 길이 체크 */
+    assert(txLen > 0);
+
+    SPI_DMAContext *ctx = &spi_dma_ctx[SPI_GetIndex(SPIx)];
+
+    /* 시작할 때 응답 없이 시작했으면 송신 DMA 요청이 꺼져 있으므로 변경만 허용 */
+    if (ctx->pSlaveTx == NULL)
+    {
+        return;
+    }
+
+    ctx->pSlaveTx = txData;
+    ctx->SlaveTxLen = txLen;
+}
+
+/* 슬레이브 NSS 상승 에지 처리 */
+void SPI_Slave_NSSHandler(SPI_TypeDef *SPIx)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+
+    SPI_DMAContext *ctx = &spi_dma_ctx[SPI_GetIndex(SPIx)];
+    const SPI_DMAMap *map = &spi_dma_map[SPI_GetIndex(SPIx)];
+    SPI_Status status = SPI_OK;
+    uint16_t start = ctx->RingPos;
+    uint16_t pos;
+    uint16_t len;
+
+    if (!ctx->Busy || ctx->Xfer != SPI_DMA_SLAVE)
+    {
+        return;
+    }
+
+    /* 링 쓰기 위치 = 전체 - 남은 횟수 (NDTR은 1..RingSize, 순환 시 RingSize로 재적재) */
+    pos = ctx->RingSize - DMA_GetCount(map->DMAx, map->RxStream);
+    if (pos == ctx->RingSize)
+    {
+        pos = 0;
+    }
+    len = (pos >= start) ? (uint16_t)(pos - start) : (uint16_t)(ctx->RingSize - start + pos);
+    ctx->RingPos = pos;
+
+    /* DMA가 수신 속도를 따라가지 못한 경우 */
+    if (SPIx->SR.b.OVR)
+    {
+        SPI_ClearOverrun(SPIx);
+        status = SPI_ERROR;
+    }
+
+    /* 다음 프레임 응답을 처음부터 다시 적재 */
+    if (ctx->pSlaveTx != NULL)
+    {
+        SPI_SlaveResetTx(SPIx, ctx, map);
+    }
+
+    ctx->SlaveCallback(SPIx, start, len, status);
+}
+
+/* 슬레이브 DMA 중단 */
+void SPI_Slave_Stop_DMA(SPI_TypeDef *SPIx)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+
+    SPI_DMAContext *ctx = &spi_dma_ctx[SPI_GetIndex(SPIx)];
+    const SPI_DMAMap *map = &spi_dma_map[SPI_GetIndex(SPIx)];
+
+    if (!ctx->Busy || ctx->Xfer != SPI_DMA_SLAVE)
+    {
+        return;
+    }
+
+    SPIx->CR2.b.TXDMAEN = 0;
+    SPIx->CR2.b.RXDMAEN = 0;
+    DMA_DisableInterrupts(map->DMAx, map->TxStream);
+    DMA_Disable(map->DMAx, map->TxStream);
+    DMA_ClearFlags(map->DMAx, map->TxStream);
+    DMA_DisableInterrupts(map->DMAx, map->RxStream);
+    DMA_Disable(map->DMAx, map->RxStream);
+    DMA_ClearFlags(map->DMAx, map->RxStream);
+    SPI_ClearOverrun(SPIx);
+
+    ctx->Busy = 0;
+}
+
+/* SPI DMA 스트림 인터럽트 핸들러 */
+void SPI_DMA_IRQHandler(SPI_TypeDef *SPIx)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+
+    SPI_DMAContext *ctx = &spi_dma_ctx[SPI_GetIndex(SPIx)];
+    const SPI_DMAMap *map = &spi_dma_map[SPI_GetIndex(SPIx)];
+    uint8_t use_rx = (ctx->Xfer != SPI_DMA_TX_ONLY && ctx->Xfer != SPI_DMA_FILL);
+    uint8_t use_tx = (ctx->Xfer != SPI_DMA_RX_SIMPLEX);
+    SPI_Status status = SPI_OK;
+
+    if (!ctx->Busy)
+    {
+        return;
+    }
+
+    if (ctx->Xfer == SPI_DMA_STREAM)
+    {
+        SPI_DMAStreamIRQ(SPIx, ctx, map);
+        return;
+    }
+
+    /* 슬레이브는 오류 인터럽트만 사용 - 수신 링을 멈추고 보고 */
+    if (ctx->Xfer == SPI_DMA_SLAVE)
+    {
+        if (DMA_IsTransferError(map->DMAx, map->TxStream) || DMA_IsTransferError(map->DMAx, map->RxStream))
+        {
+            SPI_Slave_Stop_DMA(SPIx);
+            ctx->SlaveCallback(SPIx, 0, 0, SPI_ERROR);
+        }
+        return;
+    }
+
+    /* 채우기: 남은 프레임이 있으면 같은 값으로 TX 스트림만 다시 설정 (TXDMAEN 유지) */
+    if (ctx->Xfer == SPI_DMA_FILL && ctx->FillRemaining > 0 &&
+        !DMA_IsTransferError(map->DMAx, map->TxStream) && DMA_IsTransferComplete(map->DMAx, map->TxStream))
+    {
+        uint16_t chunk = (ctx->FillRemaining > 0xFFFF) ? 0xFFFF : (uint16_t)ctx->FillRemaining;
+
+        ctx->FillRemaining -= chunk;
+        DMA_ClearFlags(map->DMAx, map->TxStream);
+        DMA_ConfigTransfer(map->DMAx, map->TxStream, (uint32_t)&ctx->FillValue, (uint32_t)&SPIx->DR, chunk);
+        DMA_Enable(map->DMAx, map->TxStream);
+        return;
+    }
+
+    if ((use_tx && DMA_IsTransferError(map->DMAx, map->TxStream)) || (use_rx && DMA_IsTransferError(map->DMAx, map->RxStream)))
+    {
+        status = SPI_ERROR;
+    }
+    else if (use_rx)
+    {
+        /* 송신 스트림 완료는 무시 - 마지막 프레임 수신(RX 완료)이 전체 완료 */
+        if (use_tx && DMA_IsTransferComplete(map->DMAx, map->TxStream))
+        {
+            DMA_ClearFlags(map->DMAx, map->TxStream);
+        }
+        if (!DMA_IsTransferComplete(map->DMAx, map->RxStream))
+        {
+            return;
+        }
+    }
+    else if (!DMA_IsTransferComplete(map->DMAx, map->TxStream))
+    {
+        return;
+    }
+
+    /* 단방향 수신: 송신 스트림이 없으므로 가능한 빨리 클럭 정지 후 추가 수신 프레임 정리 */
+    if (!use_tx)
+    {
+        SPI_RxSimplexStop(SPIx);
+        SPI_ClearOverrun(SPIx);
+    }
+
+    /* 두 스트림 정리 및 DMA 요청 비활성화 */
+    if (use_tx)
+    {
+        DMA_DisableInterrupts(map->DMAx, map->TxStream);
+        DMA_Disable(map->DMAx, map->TxStream);
+        DMA_ClearFlags(map->DMAx, map->TxStream);
+    }
+    if (use_rx)
+    {
+        DMA_DisableInterrupts(map->DMAx, map->RxStream);
+        DMA_Disable(map->DMAx, map->RxStream);
+        DMA_ClearFlags(map->DMAx, map->RxStream);
+    }
+    SPIx->CR2.b.TXDMAEN = 0;
+    SPIx->CR2.b.RXDMAEN = 0;
+
+    /* 송신 전용: 마지막 프레임(CRC 포함)이 시프트 레지스터에서 나갈 때까지 대기 후 수신 측 정리 */
+    if (!use_rx && status == SPI_OK)
+    {
+        status = SPI_WaitIdle(SPIx);
+        SPI_ClearOverrun(SPIx);
+        (void)SPI_CRCCheck(SPIx);
+    }
+
+    /* 수신 DMA는 데이터만 옮기므로 뒤따라 오는 CRC 프레임을 읽은 뒤 검사 */
+    if (use_rx && status == SPI_OK && SPIx->CR1.b.CRCEN)
+    {
+        uint32_t timeout = SPI_TIMEOUT_DEFAULT;
+
+        while (!SPIx->SR.b.RXNE)
+        {
+            if (--timeout == 0)
+            {
+                status = SPI_TIMEOUT;
+                break;
+            }
+        }
+        if (status == SPI_OK)
+        {
+            (void)SPIx->DR;
+            status = SPI_CRCCheck(SPIx);
+        }
+    }
+
+    ctx->Busy = 0;
+
+    if (ctx->Callback != NULL)
+    {
+        ctx->Callback(SPIx, status);
+    }
+}
+
+/* 인터럽트 전송 종료 내부 함수 - 인터럽트 비활성화 후 콜백 호출 */
+static void SPI_CloseTransfer_IT(SPI_Handle *hspi, SPI_Status status)
+{
+    SPI_TypeDef *SPIx = hspi->Instance;
+
+    SPIx->CR2.b.TXEIE = 0;
+    SPIx->CR2.b.RXNEIE = 0;
+    SPIx->CR2.b.ERRIE = 0;
+
+    hspi->ErrorCode = status;
+    hspi->State = SPI_STATE_READY;
+
+    if (status == SPI_OK)
+    {
+        if (hspi->XferCpltCallback != NULL)
+        {
+            hspi->XferCpltCallback(hspi);
+        }
+    }
+    else if (hspi->ErrorCallback != NULL)
+    {
+        hspi->ErrorCallback(hspi);
+    }
+}
+
+/* 인터럽트 전송 시작 내부 함수 */
+static SPI_Status SPI_StartTransfer_IT(SPI_Handle *hspi, uint8_t *txData, uint8_t *rxData, uint16_t len, SPI_State state)
+{
+    SPI_TypeDef *SPIx = hspi->Instance;
+
+    if (hspi->State != SPI_STATE_READY)
+    {
+        return SPI_BUSY;
+    }
+
+    /* 인터럽트 경로는 하드웨어 CRC 미지원, 완료를 RXNE로 판단하므로 수신 전용/반이중 모드도 미지원 */
+    if (SPIx->CR1.b.CRCEN || SPI_IsRxSimplex(SPIx))
+    {
+        return SPI_ERROR;
+    }
+
+    hspi->pTxBuffer = txData;
+    hspi->TxSize = len;
+    hspi->TxCount = 0;
+    hspi->pRxBuffer = rxData;
+    hspi->RxSize = len;
+    hspi->RxCount = 0;
+    hspi->ErrorCode = SPI_OK;
+    hspi->State = state;
+
+    /* 이전 전송에서 남은 수신 데이터와 OVR 정리 */
+    SPI_ClearOverrun(SPIx);
+
+    /* 수신/오류 인터럽트를 먼저 켠 뒤 TXEIE로 전송 시작 (TXE는 즉시 설정되어 있음) */
+    SPIx->CR2.b.ERRIE = 1;
+    SPIx->CR2.b.RXNEIE = 1;
+    SPIx->CR2.b.TXEIE = 1;
+
+    return SPI_OK;
+}
+
+/* 핸들 초기화 */
+SPI_Status SPI_InitHandle(SPI_Handle *hspi)
+{
+    /* 널 포인터 체크 */
+    assert(hspi != NULL);
+    assert(hspi->Instance != NULL);
+
+    SPI_Init(hspi->Instance, &hspi->Config);
+
+    hspi->TxCount = 0;
+    hspi->RxCount = 0;
+    hspi->ErrorCode = SPI_OK;
+    hspi->State = SPI_STATE_READY;
+
+    return SPI_OK;
+}
+
+/* 인터럽트 모드 송수신 시작 */
+SPI_Status SPI_TransferData_IT(SPI_Handle *hspi, uint8_t *txData, uint8_t *rxData, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(hspi != NULL);
+    assert(hspi->Instance != NULL);
+    assert(txData != NULL);
+    assert(rxData != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return SPI_StartTransfer_IT(hspi, txData, rxData, len, SPI_STATE_BUSY_TX_RX);
+}
+
+/* 인터럽트 모드 송신 시작 */
+SPI_Status SPI_WriteData_IT(SPI_Handle *hspi, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(hspi != NULL);
+    assert(hspi->Instance != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return SPI_StartTransfer_IT(hspi, data, NULL, len, SPI_STATE_BUSY_TX);
+}
+
+/* 인터럽트 모드 수신 시작 */
+SPI_Status SPI_ReadData_IT(SPI_Handle *hspi, uint8_t *data, uint16_t len)
+{
+    /* 널 포인터 체크 */
+    assert(hspi != NULL);
+    assert(hspi->Instance != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    return SPI_StartTransfer_IT(hspi, NULL, data, len, SPI_STATE_BUSY_RX);
+}
+
+/* SPI 인터럽트 핸들러 */
+void SPI_IRQHandler(SPI_Handle *hspi)
+{
+    /* 널 포인터 체크 */
+    assert(hspi != NULL);
+    assert(hspi->Instance != NULL);
+
+    SPI_TypeDef *SPIx = hspi->Instance;
+    uint8_t frame16 = SPIx->CR1.b.DFF;
+    uint16_t frame;
+
+    if (hspi->State == SPI_STATE_READY)
+    {
+        return;
+    }
+
+    /* 오버런 또는 모드 오류 - 전송 중단 */
+    if (SPIx->CR2.b.ERRIE && (SPIx->SR.b.OVR || SPIx->SR.b.MODF))
+    {
+        if (SPIx->SR.b.MODF)
+        {
+            /* MODF 해제: SR 읽기 후 CR1 쓰기 (MSTR/SPE 복원) */
+            SPIx->CR1.b.MSTR = 1;
+            SPIx->CR1.b.SPE = 1;
+        }
+        SPI_ClearOverrun(SPIx);
+        SPI_CloseTransfer_IT(hspi, SPI_ERROR);
+        return;
+    }
+
+    /* 수신 처리를 먼저 수행하여 다음 프레임이 도착하기 전에 DR을 비움 */
+    if (SPIx->SR.b.RXNE && SPIx->CR2.b.RXNEIE)
+    {
+        frame = (uint16_t)SPIx->DR;
+        if (hspi->pRxBuffer != NULL)
+        {
+            if (frame16)
+            {
+                *(uint16_t *)hspi->pRxBuffer = frame;
+                hspi->pRxBuffer += 2;
+            }
+            else
+            {
+                *hspi->pRxBuffer++ = (uint8_t)frame;
+            }
+        }
+        hspi->RxCount++;
+
+        /* 마지막 프레임 수신 = 전송 완료 (BSY는 곧바로 해제됨) */
+        if (hspi->RxCount >= hspi->RxSize)
+        {
+            SPI_CloseTransfer_IT(hspi, SPI_WaitIdle(SPIx));
+            return;
+        }
+    }
+
+    /* 송신 처리 */
+    if (SPIx->SR.b.TXE && SPIx->CR2.b.TXEIE)
+    {
+        if (hspi->pTxBuffer == NULL)
+        {
+            SPIx->DR = 0xFFFF;
+        }
+        else if (frame16)
+        {
+            SPIx->DR = *(uint16_t *)hspi->pTxBuffer;
+            hspi->pTxBuffer += 2;
+        }
+        else
+        {
+            SPIx->DR = *hspi->pTxBuffer++;
+        }
+        hspi->TxCount++;
+
+        if (hspi->TxCount >= hspi->TxSize)
+        {
+            SPIx->CR2.b.TXEIE = 0;
+        }
+    }
+}
+
+/* 하드웨어 CRC 초기화 */
+void SPI_ResetCRC(SPI_TypeDef *SPIx)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+
+    /* CRCEN은 SPE=0 상태에서만 변경 가능 */
+    SPIx->CR1.b.SPE = 0;
+    SPIx->CR1.b.CRCEN = 0;
+    SPIx->CR1.b.CRCEN = 1;
+    SPIx->CR1.b.SPE = 1;
+
+    (void)SPI_CRCCheck(SPIx);
+}
+
+/* NSS 핀 제어 */
+void SPI_SetNSS(SPI_TypeDef *SPIx, uint8_t state)
+{
+    /* 널 포인터 체크 */
+    assert(SPIx != NULL);
+
+    if (SPIx->CR1.b.SSM)
+    {
+        SPIx->CR1.b.SSI = state;
+    }
+}
@@ -2,6 +2,12 @@
 #define __SPI_H
 
 #include "stm32f411xe.h"
+#include "dma.h"
+
+/**
+ * @brief 하드웨어 CRC 다항식 기본값 (CRCPR 리셋값, CRC-8: x^8 + x^2 + x + 1)
+ */
+#define SPI_CRC_POLYNOMIAL_DEFAULT 0x0007
 
 /**
  * @brief SPI 통신 상태를 나타내는 열거형
@@ -10,8 +16,9 @@ typedef enum
 {
     SPI_OK = 0, /*!< 정상 동작 완료 */
     SPI_ERROR,  /*!< 일반적인 오류 발생 */
-    SPI_BUSY,   /*!< SPI 버스가 사용 중 */
-    SPI_TIMEOUT /*!< 타임아웃 발생 */
+    SPI_BUSY,     /*!< SPI 버스가 사용 중 */
+    SPI_TIMEOUT,  /*!< 타임아웃 발생 */
+    SPI_CRC_ERROR /*!< 수신 CRC 불일치 (CRCERR) */
 } SPI_Status;
 
 /**
@@ -25,31 +32,114 @@ typedef enum
     SPI_MODE_3      /*!< CPOL = 1, CPHA = 1 */
 } SPI_Mode;
 
+/**
+ * @brief SPI 데이터 라인 방향을 나타내는 열거형
+ */
+typedef enum
+{
+    SPI_DIRECTION_2LINES = 0,    /*!< 전이중 (MOSI/MISO) */
+    SPI_DIRECTION_2LINES_RXONLY, /*!< 단방향 수신 전용 (RXONLY=1, 더미 송신 없이 클럭 연속 생성) */
+    SPI_DIRECTION_1LINE          /*!< 반이중 3선 (BIDIMODE=1, 한 데이터 선을 BIDIOE로 송수신 전환) */
+} SPI_Direction;
+
 /**
  * @brief SPI 초기화를 위한 설정 구조체
  */
 typedef struct
 {
-    uint32_t ClockSpeed; /*!< SPI 통신 속도 (Hz). 범위: 최대 PCLK/2 */
+    uint32_t ClockSpeed; /*!< SPI 최대 통신 속도 (Hz). 이 값을 넘지 않는 PCLK/2 ~ PCLK/256 중 가장 빠른 속도를 사용 */
     SPI_Mode Mode;       /*!< SPI 모드 (0-3) */
     uint8_t DataSize;    /*!< 데이터 크기. 0: 8비트, 1: 16비트 */
     uint8_t FirstBit;    /*!< 첫 비트 전송 순서. 0: MSB first, 1: LSB first */
     uint8_t NSS;         /*!< NSS 핀 관리 방식. 0: 하드웨어, 1: 소프트웨어 */
+    SPI_Direction Direction; /*!< 데이터 라인 방향 (기본값 SPI_DIRECTION_2LINES) */
+    uint8_t Slave;       /*!< 동작 모드. 0: 마스터, 1: 슬레이브 (ClockSpeed 무시, 하드웨어 NSS면 NSS 핀 입력으로 선택) */
+    uint8_t CRCEnable;   /*!< 하드웨어 CRC. 0: 비활성화, 1: 전송 끝에 CRC 송신 및 수신 CRC 검사 */
+    uint16_t CRCPolynomial; /*!< CRC 다항식 (CRCEnable=1일 때 사용, 0이면 SPI_CRC_POLYNOMIAL_DEFAULT). CRC 길이는 DataSize를 따름 */
 } SPI_Config;
 
+/**
+ * @brief SPI DMA 전송 완료 콜백 함수 타입
+ * @param SPIx: 전송을 완료한 SPI 주변장치
+ * @param status: 전송 결과 (SPI_OK 또는 오류 코드)
+ */
+typedef void (*SPI_DMACallback)(SPI_TypeDef *SPIx, SPI_Status status);
+
+/**
+ * @brief SPI 연속 수신(순환 DMA) 콜백 함수 타입
+ * @param SPIx: 수신 중인 SPI 주변장치
+ * @param data: 방금 채워진 버퍼 절반의 시작 주소 (오류 시 NULL)
+ * @param len: 채워진 프레임 수 (버퍼 크기의 절반, 오류 시 0)
+ * @param status: SPI_OK 또는 SPI_ERROR (DMA 전송 오류로 스트림이 중단됨)
+ */
+typedef void (*SPI_StreamCallback)(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len, SPI_Status status);
+
+/**
+ * @brief SPI 슬레이브 프레임 수신 콜백 함수 타입
+ * @param SPIx: 프레임을 수신한 SPI 주변장치
+ * @param offset: 수신 링에서 프레임 시작 위치 (프레임 단위)
+ * @param len: 수신한 프레임 수 (링 끝을 넘으면 링 처음으로 이어짐, 오류로 중단되면 0)
+ * @param status: SPI_OK, SPI_ERROR(OVR 발생 - 일부 데이터 유실, 또는 DMA 오류로 중단)
+ */
+typedef void (*SPI_SlaveCallback)(SPI_TypeDef *SPIx, uint16_t offset, uint16_t len, SPI_Status status);
+
+/**
+ * @brief SPI 핸들의 전송 상태를 나타내는 열거형
+ */
+typedef enum
+{
+    SPI_STATE_READY = 0, /*!< 전송 대기 상태 */
+    SPI_STATE_BUSY_TX,   /*!< 인터럽트 기반 송신 진행 중 (수신 데이터 폐기) */
+    SPI_STATE_BUSY_RX,   /*!< 인터럽트 기반 수신 진행 중 (더미 송신) */
+    SPI_STATE_BUSY_TX_RX /*!< 인터럽트 기반 송수신 진행 중 */
+} SPI_State;
+
+/**
+ * @brief SPI 핸들 구조체
+ * @note  DataSize가 16비트이면 버퍼는 uint16_t 배열로 취급하며, 크기와 카운트는 프레임 단위입니다.
+ */
+typedef struct __SPI_Handle
+{
+    SPI_TypeDef *Instance;          /*!< SPI 레지스터 베이스 주소 */
+    SPI_Config   Config;            /*!< SPI 설정 */
+    uint8_t     *pTxBuffer;         /*!< 송신 버퍼 포인터 (수신 전용이면 NULL) */
+    uint16_t     TxSize;            /*!< 송신 프레임 수 */
+    uint16_t     TxCount;           /*!< 송신된 프레임 수 */
+    uint8_t     *pRxBuffer;         /*!< 수신 버퍼 포인터 (송신 전용이면 NULL) */
+    uint16_t     RxSize;            /*!< 수신 프레임 수 */
+    uint16_t     RxCount;           /*!< 수신된 프레임 수 */
+    volatile SPI_State  State;      /*!< 전송 상태 */
+    volatile SPI_Status ErrorCode;  /*!< 마지막 전송 결과 */
+    void        *pContext;          /*!< 상위 계층 컨텍스트 (드라이버는 사용하지 않음, 콜백에서 참조) */
+    void (*XferCpltCallback)(struct __SPI_Handle *hspi); /*!< 전송 완료 콜백 (NULL 허용) */
+    void (*ErrorCallback)(struct __SPI_Handle *hspi);    /*!< 전송 오류 콜백 (NULL 허용) */
+} SPI_Handle;
+
 /**
  * @brief  SPI 주변장치를 초기화합니다.
  * @param  SPIx: 초기화할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
  * @param  config: SPI 초기화 설정 구조체 포인터
  * @return None
  * @note   이 함수는 SPI 주변장치의 클럭을 활성화하고, 지정된 설정으로 초기화합니다.
+ *         분주비는 인스턴스가 연결된 버스 클럭(SPI1: PCLK2, SPI2/3: PCLK1)을 RCC에서 읽어 계산하며,
+ *         실제 SCK 주파수는 SPI_GetClock()으로 확인할 수 있습니다.
  * @warning
  *         - 이 함수 호출 전에 해당 SPI 핀들이 올바르게 설정되어 있어야 합니다.
- *         - PCLK1(APB1) 또는 PCLK2(APB2) 클럭은 기본값 16MHz로 가정합니다.
- *           다른 클럭 주파수를 사용하는 경우 코드를 수정해야 합니다.
+ *         - 초기화 후 시스템/버스 클럭을 변경한 경우 SPI_UpdateClock()을 호출해야 합니다.
  */
 void SPI_Init(SPI_TypeDef *SPIx, SPI_Config *config);
 
+/**
+ * @brief  SPI 설정에 해당하는 CR1/CR2 레지스터 값을 계산합니다.
+ * @param  SPIx: 설정을 적용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  config: SPI 설정 구조체 포인터
+ * @param  cr1: 계산된 CR1 값을 저장할 포인터 (MSTR, SPE=1 포함)
+ * @param  cr2: 계산된 CR2 값을 저장할 포인터
+ * @return None
+ * @note   레지스터는 변경하지 않습니다. 장치별 설정을 미리 계산해 두고 전환 시 레지스터에 바로 쓸 때 사용합니다.
+ */
+void SPI_BuildConfig(SPI_TypeDef *SPIx, SPI_Config *config, uint32_t *cr1, uint32_t *cr2);
+
 /**
  * @brief  SPI 주변장치를 비활성화합니다.
  * @param  SPIx: 비활성화할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
@@ -58,6 +148,24 @@ void SPI_Init(SPI_TypeDef *SPIx, SPI_Config *config);
  */
 void SPI_DeInit(SPI_TypeDef *SPIx);
 
+/**
+ * @brief  현재 설정된 실제 SCK 주파수를 반환합니다.
+ * @param  SPIx: SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @return uint32_t: SCK 주파수 (Hz, 현재 버스 클럭과 CR1의 BR로 계산)
+ */
+uint32_t SPI_GetClock(SPI_TypeDef *SPIx);
+
+/**
+ * @brief  현재 버스 클럭에 맞게 분주비를 다시 계산합니다.
+ * @param  SPIx: SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  config: 초기화에 사용한 SPI 설정 구조체 포인터 (ClockSpeed 사용)
+ * @return uint32_t: 새로 설정된 SCK 주파수 (Hz)
+ * @note   시스템/APB 클럭을 변경한 뒤 호출합니다. 분주비가 바뀐 경우에만 SPE를 잠시 끄고 BR을 씁니다.
+ *         SPI_Bus에 등록된 장치는 SPI_Bus_AddDevice()를 다시 호출해야 합니다.
+ * @warning 전송이 진행 중이 아닐 때 호출해야 합니다.
+ */
+uint32_t SPI_UpdateClock(SPI_TypeDef *SPIx, SPI_Config *config);
+
 /**
  * @brief  SPI를 통해 1바이트 데이터를 전송합니다.
  * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
@@ -85,6 +193,8 @@ SPI_Status SPI_ReadByte(SPI_TypeDef *SPIx, uint8_t *data);
  * @param  len: 전송할 데이터의 길이 (바이트)
  * @return SPI_Status: 데이터 전송 결과
  * @note   이 함수는 모든 데이터가 전송될 때까지 대기합니다.
+ * @remark TXE가 설정될 때마다 DR을 채워 프레임 사이 공백 없이 전송하며, 수신 데이터는 버리고
+ *         BSY는 마지막에 한 번만 확인합니다. 종료 시 OVR 플래그를 정리합니다.
  * @warning
  *         - data 버퍼는 최소 len 바이트의 크기를 가져야 합니다.
  *         - 전송 도중 슬레이브가 응답하지 않으면 SPI_ERROR를 반환합니다.
@@ -98,8 +208,14 @@ SPI_Status SPI_WriteData(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len);
  * @param  len: 수신할 데이터의 길이 (바이트)
  * @return SPI_Status: 데이터 수신 결과
  * @note   이 함수는 모든 데이터가 수신될 때까지 대기합니다.
+ * @remark 수신 전용(SPI_DIRECTION_2LINES_RXONLY) 또는 반이중(SPI_DIRECTION_1LINE) 모드에서는 더미 송신 없이
+ *         SPE(반이중은 BIDIOE=0)로 클럭을 연속 생성하고, 마지막 프레임 수신 중에 SPE=0으로 클럭을 멈춥니다.
+ *         SPI_ReadData16(), SPI_ReadByte()도 같습니다. 이 모드에서 동시 송수신은 SPI_ERROR를 반환하며,
+ *         수신 전용 모드에서는 쓰기도 SPI_ERROR입니다 (반이중 쓰기는 BIDIOE=1 상태에서 그대로 동작).
  * @warning
  *         - data 버퍼는 최소 len 바이트의 크기를 가져야 합니다.
+ *         - 수신 전용/반이중 읽기는 마스터 전용이며 하드웨어 CRC를 지원하지 않습니다. 마지막 프레임 정지
+ *           타이밍을 맞추기 위해 수신 중 긴 인터럽트가 끼어들면 추가 프레임이 클럭될 수 있습니다(데이터는 폐기).
  *         - 수신 도중 슬레이브가 응답하지 않으면 SPI_ERROR를 반환합니다.
  */
 SPI_Status SPI_ReadData(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len);
@@ -110,14 +226,305 @@ SPI_Status SPI_ReadData(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len);
  * @param  txData: 전송할 데이터 버퍼의 포인터
  * @param  rxData: 수신한 데이터를 저장할 버퍼의 포인터
  * @param  len: 송수신할 데이터의 길이 (바이트)
- * @return SPI_Status: 데이터 송수신 결과
+ * @return SPI_Status: 데이터 송수신 결과 (수신 CRC 불일치 시 SPI_CRC_ERROR)
  * @note   이 함수는 모든 데이터가 송수신될 때까지 대기합니다.
+ * @remark CRC가 활성화되어 있으면 마지막 데이터 직후 CRCNEXT로 CRC 프레임을 송신하고, 상대가 보낸
+ *         CRC 프레임을 받아 하드웨어 검사 결과(CRCERR)를 반환합니다. SPI_ReadData()도 같습니다.
+ *         SPI_WriteData()는 CRC를 송신만 하고 수신 CRC 결과는 무시합니다.
  * @warning
  *         - txData와 rxData 버퍼는 각각 최소 len 바이트의 크기를 가져야 합니다.
  *         - 송수신 도중 슬레이브가 응답하지 않으면 SPI_ERROR를 반환합니다.
  */
 SPI_Status SPI_TransferData(SPI_TypeDef *SPIx, uint8_t *txData, uint8_t *rxData, uint16_t len);
 
+/**
+ * @brief  하드웨어 CRC 계산 값을 초기화합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @return None
+ * @note   SPE=0 상태에서 CRCEN을 다시 설정하여 TXCRCR/RXCRCR을 0으로 만들고 CRCERR를 지웁니다.
+ *         CRC가 활성화된 경우 폴링/DMA 전송 함수는 시작할 때 이 함수를 자동으로 호출하므로,
+ *         CRC는 전송 함수 호출 한 번 단위로 계산됩니다.
+ */
+void SPI_ResetCRC(SPI_TypeDef *SPIx);
+
+/**
+ * @brief  SPI를 통해 16비트 프레임 데이터를 연속 전송합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  data: 전송할 16비트 데이터 버퍼의 포인터
+ * @param  len: 전송할 프레임 수 (16비트 단위)
+ * @return SPI_Status: 데이터 전송 결과 (DataSize가 16비트가 아니면 SPI_ERROR)
+ * @note   프레임당 DR 접근이 한 번이므로 같은 데이터를 8비트로 보낼 때보다 DR 접근이 절반입니다.
+ *         전송 방식은 SPI_WriteData()와 같습니다.
+ * @warning SPI_Init()에서 DataSize = 1(16비트)로 설정해야 합니다.
+ */
+SPI_Status SPI_WriteData16(SPI_TypeDef *SPIx, uint16_t *data, uint16_t len);
+
+/**
+ * @brief  SPI를 통해 16비트 프레임 데이터를 수신합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  data: 수신한 데이터를 저장할 16비트 버퍼의 포인터
+ * @param  len: 수신할 프레임 수 (16비트 단위)
+ * @return SPI_Status: 데이터 수신 결과 (DataSize가 16비트가 아니면 SPI_ERROR)
+ * @note   클럭 생성을 위해 프레임마다 더미 데이터(0xFFFF)를 전송합니다.
+ * @warning SPI_Init()에서 DataSize = 1(16비트)로 설정해야 합니다.
+ */
+SPI_Status SPI_ReadData16(SPI_TypeDef *SPIx, uint16_t *data, uint16_t len);
+
+/**
+ * @brief  SPI를 통해 16비트 프레임 데이터를 동시에 송수신합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  txData: 전송할 16비트 데이터 버퍼의 포인터
+ * @param  rxData: 수신한 데이터를 저장할 16비트 버퍼의 포인터
+ * @param  len: 송수신할 프레임 수 (16비트 단위)
+ * @return SPI_Status: 데이터 송수신 결과 (DataSize가 16비트가 아니면 SPI_ERROR)
+ * @warning SPI_Init()에서 DataSize = 1(16비트)로 설정해야 합니다.
+ */
+SPI_Status SPI_TransferData16(SPI_TypeDef *SPIx, uint16_t *txData, uint16_t *rxData, uint16_t len);
+
+/**
+ * @brief  DMA를 사용하여 SPI로 데이터를 동시에 송수신합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  txData: 전송할 데이터 버퍼의 포인터
+ * @param  rxData: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 송수신할 데이터의 길이 (바이트)
+ * @param  callback: 송수신 완료 시 호출될 콜백 함수 (NULL 허용)
+ * @return SPI_Status: 전송 시작 결과
+ * @note   RX/TX DMA 스트림을 함께 설정하고 즉시 반환합니다. DMA가 TXE/RXNE 요청마다 DR을
+ *         채우고 비우므로 프레임 사이에 클럭이 쉬지 않습니다. 완료는 RX 스트림 기준입니다.
+ *         스트림 매핑: SPI1 - DMA2 Stream 3(TX)/0(RX), SPI2 - DMA1 Stream 4/3, SPI3 - DMA1 Stream 5/0.
+ * @remark CRC가 활성화되어 있으면 TX 스트림 종료 후 하드웨어가 CRC를 자동 송신하며, 완료 처리에서
+ *         수신 CRC 프레임을 읽고 불일치 시 SPI_CRC_ERROR로 콜백을 호출합니다.
+ * @warning
+ *         - 전송이 완료될 때까지 버퍼는 유효해야 합니다.
+ *         - 사용하는 DMA 스트림(TX, RX 모두)의 인터럽트 핸들러에서 SPI_DMA_IRQHandler()를 호출해야 합니다.
+ *         - 이전 DMA 전송이 진행 중이면 SPI_BUSY를 반환합니다.
+ */
+SPI_Status SPI_TransferData_DMA(SPI_TypeDef *SPIx, uint8_t *txData, uint8_t *rxData, uint16_t len, SPI_DMACallback callback);
+
+/**
+ * @brief  DMA를 사용하여 SPI로 데이터를 전송합니다 (송신 전용).
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  data: 전송할 데이터 버퍼의 포인터
+ * @param  len: 전송할 데이터의 길이 (바이트)
+ * @param  callback: 전송 완료 시 호출될 콜백 함수 (NULL 허용)
+ * @return SPI_Status: 전송 시작 결과
+ * @note   TX 스트림만 사용합니다. 완료 시 마지막 프레임이 나갈 때까지(BSY) 기다린 뒤
+ *         수신 측에 쌓인 데이터와 OVR 플래그를 정리하고 콜백을 호출합니다.
+ * @warning SPI_TransferData_DMA()와 같은 제약이 적용됩니다.
+ */
+SPI_Status SPI_WriteData_DMA(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len, SPI_DMACallback callback);
+
+/**
+ * @brief  DMA를 사용하여 SPI로 데이터를 수신합니다 (수신 전용).
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  data: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 수신할 데이터의 길이 (바이트)
+ * @param  callback: 수신 완료 시 호출될 콜백 함수 (NULL 허용)
+ * @return SPI_Status: 수신 시작 결과
+ * @note   클럭 생성을 위해 TX 스트림은 메모리 주소 증가 없이 더미 바이트(0xFF)를 반복 전송합니다.
+ *         수신 전용/반이중 모드에서는 TX 스트림 없이 RX 스트림만 사용하고 SPE로 클럭을 생성하며,
+ *         완료 인터럽트에서 클럭을 멈춥니다 (SPI_ReadData16_DMA(), SPI_ReadStream_DMA()도 같음).
+ * @warning SPI_TransferData_DMA()와 같은 제약이 적용됩니다. 수신 전용/반이중 모드에서는 완료 인터럽트
+ *          지연 동안 추가 프레임이 클럭될 수 있으므로(데이터는 폐기) 칩 셀렉트로 프레임을 구분해야 합니다.
+ */
+SPI_Status SPI_ReadData_DMA(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len, SPI_DMACallback callback);
+
+/**
+ * @brief  DMA를 사용하여 SPI로 16비트 프레임 데이터를 동시에 송수신합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  txData: 전송할 16비트 데이터 버퍼의 포인터
+ * @param  rxData: 수신한 데이터를 저장할 16비트 버퍼의 포인터
+ * @param  len: 송수신할 프레임 수 (16비트 단위, 최대 65535)
+ * @param  callback: 송수신 완료 시 호출될 콜백 함수 (NULL 허용)
+ * @return SPI_Status: 전송 시작 결과 (DataSize가 16비트가 아니면 SPI_ERROR)
+ * @note   DMA 스트림을 하프워드 단위로 설정하므로 프레임당 DMA 요청이 한 번입니다.
+ * @warning
+ *         - SPI_Init()에서 DataSize = 1(16비트)로 설정해야 합니다.
+ *         - 버퍼는 2바이트 정렬되어야 합니다.
+ *         - 그 밖에는 SPI_TransferData_DMA()와 같은 제약이 적용됩니다.
+ */
+SPI_Status SPI_TransferData16_DMA(SPI_TypeDef *SPIx, uint16_t *txData, uint16_t *rxData, uint16_t len, SPI_DMACallback callback);
+
+/**
+ * @brief  DMA를 사용하여 SPI로 16비트 프레임 데이터를 전송합니다 (송신 전용).
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  data: 전송할 16비트 데이터 버퍼의 포인터
+ * @param  len: 전송할 프레임 수 (16비트 단위, 최대 65535)
+ * @param  callback: 전송 완료 시 호출될 콜백 함수 (NULL 허용)
+ * @return SPI_Status: 전송 시작 결과 (DataSize가 16비트가 아니면 SPI_ERROR)
+ * @warning SPI_TransferData16_DMA()와 같은 제약이 적용됩니다.
+ */
+SPI_Status SPI_WriteData16_DMA(SPI_TypeDef *SPIx, uint16_t *data, uint16_t len, SPI_DMACallback callback);
+
+/**
+ * @brief  DMA를 사용하여 SPI로 16비트 프레임 데이터를 수신합니다 (수신 전용).
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  data: 수신한 데이터를 저장할 16비트 버퍼의 포인터
+ * @param  len: 수신할 프레임 수 (16비트 단위, 최대 65535)
+ * @param  callback: 수신 완료 시 호출될 콜백 함수 (NULL 허용)
+ * @return SPI_Status: 수신 시작 결과 (DataSize가 16비트가 아니면 SPI_ERROR)
+ * @note   TX 스트림은 더미 데이터(0xFFFF)를 반복 전송합니다.
+ * @warning SPI_TransferData16_DMA()와 같은 제약이 적용됩니다.
+ */
+SPI_Status SPI_ReadData16_DMA(SPI_TypeDef *SPIx, uint16_t *data, uint16_t len, SPI_DMACallback callback);
+
+/**
+ * @brief  DMA로 같은 값을 count 프레임 반복 송신합니다 (화면 지우기, 패딩 등).
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  value: 송신할 값 (8비트 프레임이면 하위 바이트만 사용)
+ * @param  count: 송신할 프레임 수 (65535 초과 가능)
+ * @param  callback: 송신 완료 시 호출될 콜백 함수 (NULL 허용)
+ * @return SPI_Status: 송신 시작 결과 (수신 전용 모드 또는 CRC 사용 시 SPI_ERROR)
+ * @note   TX 스트림의 메모리 주소 증가를 끄고 값 하나를 반복 전송하므로 채우기용 RAM 버퍼와 CPU 복사가
+ *         필요 없습니다. 한 번에 최대 65535 프레임이며, 그보다 많으면 완료 인터럽트에서 스트림을 자동으로
+ *         다시 설정해 이어서 보냅니다 (구간 사이에 인터럽트 처리 시간만큼 짧은 공백이 생길 수 있음).
+ *         수신 데이터는 버리며 완료는 SPI_WriteData_DMA()와 같이 마지막 프레임 송신 후입니다.
+ * @warning 사용하는 DMA 스트림(TX)의 인터럽트 핸들러에서 SPI_DMA_IRQHandler()를 호출해야 합니다.
+ */
+SPI_Status SPI_Fill_DMA(SPI_TypeDef *SPIx, uint16_t value, uint32_t count, SPI_DMACallback callback);
+
+/**
+ * @brief  순환 DMA로 연속 수신을 시작합니다 (핑퐁 버퍼).
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  buffer: 수신 버퍼 (두 절반으로 나누어 번갈아 사용)
+ * @param  len: 버퍼 크기 (프레임 수, 짝수)
+ * @param  callback: 버퍼 절반이 채워질 때마다 호출될 콜백 함수
+ * @return SPI_Status: 시작 결과 (다른 DMA 전송이 진행 중이면 SPI_BUSY)
+ * @note   RX 스트림은 순환 모드로 buffer를 반복해서 채우고, TX 스트림은 순환 모드로 더미(0xFF)를
+ *         계속 보내 클럭을 끊김 없이 생성합니다. 절반 전송(HT) 시 앞쪽 절반, 전송 완료(TC) 시 뒤쪽
+ *         절반으로 콜백을 호출하므로 DMA가 다른 절반을 채우는 동안 처리할 수 있습니다.
+ *         SPI_StopStream_DMA()를 호출할 때까지 계속됩니다. 16비트 프레임이면 buffer는 uint16_t 배열입니다.
+ * @warning
+ *         - 콜백은 DMA가 같은 절반을 다시 채우기 전(버퍼 절반의 전송 시간 안)에 처리를 끝내야 합니다.
+ *         - 하드웨어 CRC는 적용되지 않습니다.
+ *         - 사용하는 DMA 스트림의 인터럽트 핸들러에서 SPI_DMA_IRQHandler()를 호출해야 합니다.
+ */
+SPI_Status SPI_ReadStream_DMA(SPI_TypeDef *SPIx, uint8_t *buffer, uint16_t len, SPI_StreamCallback callback);
+
+/**
+ * @brief  순환 DMA 연속 수신을 중단합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @return None
+ * @note   TX 스트림을 먼저 멈춰 클럭을 멈추고, 마지막 프레임이 끝난 뒤 RX 스트림을 정리합니다.
+ *         스트림 콜백 안에서 호출해도 됩니다. 연속 수신 중이 아니면 아무 동작도 하지 않습니다.
+ */
+void SPI_StopStream_DMA(SPI_TypeDef *SPIx);
+
+/**
+ * @brief  슬레이브 모드 DMA 수신 링과 응답 송신을 시작합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (Slave=1로 초기화된 SPI1, SPI2 또는 SPI3)
+ * @param  ring: 수신 링 버퍼 (16비트 프레임이면 uint16_t 배열)
+ * @param  ringLen: 수신 링 크기 (프레임 수)
+ * @param  txData: 매 프레임 처음부터 송신할 응답 버퍼 (NULL이면 송신 DMA 미사용)
+ * @param  txLen: 응답 길이 (프레임 수)
+ * @param  callback: 프레임이 끝날 때(SPI_Slave_NSSHandler) 호출될 콜백 함수
+ * @return SPI_Status: 시작 결과 (마스터 모드이면 SPI_ERROR, 다른 DMA 전송이 진행 중이면 SPI_BUSY)
+ * @note   RX 스트림은 순환 모드로 링을 계속 채우며 프레임마다 다시 설정하지 않습니다. 바이트 단위 인터럽트가
+ *         없으므로 수 Mbit/s 이상의 연속 수신에도 CPU 부하가 없습니다. 응답은 SPE 전에 적재되어
+ *         마스터의 첫 클럭부터 송신됩니다.
+ * @warning
+ *         - 링은 처리되지 않은 프레임을 덮어쓰지 않을 만큼 커야 합니다.
+ *         - 응답보다 긴 프레임에서는 마지막 응답 프레임이 반복 송신됩니다.
+ *         - 사용하는 DMA 스트림의 인터럽트 핸들러에서 SPI_DMA_IRQHandler()를 호출해야 합니다 (오류 처리용).
+ */
+SPI_Status SPI_Slave_Start_DMA(SPI_TypeDef *SPIx, uint8_t *ring, uint16_t ringLen, uint8_t *txData, uint16_t txLen, SPI_SlaveCallback callback);
+
+/**
+ * @brief  다음 프레임부터 송신할 슬레이브 응답 버퍼를 변경합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @param  txData: 응답 버퍼
+ * @param  txLen: 응답 길이 (프레임 수)
+ * @return None
+ * @note   다음 NSS 상승 에지에서 적용됩니다. 슬레이브 콜백 안에서 호출하면 그 다음 프레임부터 적용됩니다.
+ *         응답 없이(txData=NULL) 시작한 경우에는 아무 동작도 하지 않습니다.
+ */
+void SPI_Slave_SetResponse(SPI_TypeDef *SPIx, uint8_t *txData, uint16_t txLen);
+
+/**
+ * @brief  슬레이브 프레임 종료(NSS 상승 에지)를 처리합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @return None
+ * @note   NSS 핀 상승 에지 EXTI 인터럽트 핸들러에서 호출합니다. 수신 링 DMA의 NDTR로 프레임 길이를 구해
+ *         콜백을 호출하고, 응답 송신 DMA를 처음부터 다시 적재합니다. 이미 DR에 적재된 응답 데이터는
+ *         SPE로 비울 수 없으므로 주변장치를 리셋한 뒤 설정을 복원합니다.
+ * @warning 마스터는 NSS를 올린 뒤 다음 프레임 전까지 이 처리가 끝날 시간을 두어야 합니다.
+ */
+void SPI_Slave_NSSHandler(SPI_TypeDef *SPIx);
+
+/**
+ * @brief  슬레이브 모드 DMA를 중단합니다.
+ * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @return None
+ * @note   슬레이브 DMA가 동작 중이 아니면 아무 동작도 하지 않습니다.
+ */
+void SPI_Slave_Stop_DMA(SPI_TypeDef *SPIx);
+
+/**
+ * @brief  SPI DMA 스트림 인터럽트 핸들러입니다.
+ * @param  SPIx: DMA 전송을 진행 중인 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
+ * @return None
+ * @note   전송 완료 시 DMA 요청을 비활성화하고 콜백을 호출합니다. 전송 오류 시 두 스트림을
+ *         모두 중단하고 SPI_ERROR로 콜백을 호출합니다.
+ */
+void SPI_DMA_IRQHandler(SPI_TypeDef *SPIx);
+
+/**
+ * @brief  SPI 핸들을 초기화합니다.
+ * @param  hspi: SPI 핸들 구조체 포인터 (Instance, Config, 콜백 설정 후 호출)
+ * @return SPI_Status: 초기화 결과
+ * @note   SPI_Init()으로 주변장치를 초기화하고 핸들 상태를 READY로 설정합니다.
+ */
+SPI_Status SPI_InitHandle(SPI_Handle *hspi);
+
+/**
+ * @brief  인터럽트 모드로 SPI 송수신을 시작합니다.
+ * @param  hspi: SPI 핸들 구조체 포인터
+ * @param  txData: 전송할 데이터 버퍼의 포인터
+ * @param  rxData: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 송수신할 프레임 수
+ * @return SPI_Status: 전송 시작 결과 (진행 중인 전송이 있으면 SPI_BUSY)
+ * @note   TXEIE/RXNEIE/ERRIE를 활성화하고 즉시 반환합니다. 인터럽트마다 DR을 채우고 비우며,
+ *         마지막 프레임 수신 후 XferCpltCallback을 호출합니다.
+ * @remark 하드웨어 CRC는 지원하지 않으며, CRC가 활성화되어 있으면 SPI_ERROR를 반환합니다.
+ * @warning
+ *         - 전송이 완료될 때까지 버퍼는 유효해야 합니다.
+ *         - SPI 인터럽트 핸들러(SPIx_IRQHandler)에서 SPI_IRQHandler()를 호출해야 합니다.
+ *         - 인터럽트 지연이 한 프레임 시간보다 길면 OVR이 발생하므로 높은 SCK에서는 DMA를 사용하십시오.
+ */
+SPI_Status SPI_TransferData_IT(SPI_Handle *hspi, uint8_t *txData, uint8_t *rxData, uint16_t len);
+
+/**
+ * @brief  인터럽트 모드로 SPI 송신을 시작합니다 (송신 전용).
+ * @param  hspi: SPI 핸들 구조체 포인터
+ * @param  data: 전송할 데이터 버퍼의 포인터
+ * @param  len: 전송할 프레임 수
+ * @return SPI_Status: 전송 시작 결과
+ * @note   수신 데이터는 RXNE 인터럽트에서 버리며, 마지막 프레임 수신 시점을 전송 완료로 판단하므로
+ *         인터럽트에서 BSY를 오래 기다리지 않습니다.
+ * @warning SPI_TransferData_IT()와 같은 제약이 적용됩니다.
+ */
+SPI_Status SPI_WriteData_IT(SPI_Handle *hspi, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  인터럽트 모드로 SPI 수신을 시작합니다 (수신 전용).
+ * @param  hspi: SPI 핸들 구조체 포인터
+ * @param  data: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 수신할 프레임 수
+ * @return SPI_Status: 수신 시작 결과
+ * @note   클럭 생성을 위해 프레임마다 더미 데이터(0xFF 또는 0xFFFF)를 전송합니다.
+ * @warning SPI_TransferData_IT()와 같은 제약이 적용됩니다.
+ */
+SPI_Status SPI_ReadData_IT(SPI_Handle *hspi, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  SPI 인터럽트 핸들러입니다.
+ * @param  hspi: SPI 핸들 구조체 포인터
+ * @return None
+ * @note   이 함수는 SPI 인터럽트 발생 시 호출되어야 합니다. OVR 또는 MODF가 발생하면 전송을
+ *         중단하고 ErrorCode = SPI_ERROR로 ErrorCallback을 호출합니다.
+ */
+void SPI_IRQHandler(SPI_Handle *hspi);
+
 /**
  * @brief  NSS(Slave Select) 핀을 제어합니다.
  * @param  SPIx: 사용할 SPI 주변장치 (SPI1, SPI2 또는 SPI3)
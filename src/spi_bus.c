@@ -0,0 +1,183 @@
+#include "spi_bus.h"
+#include <assert.h>
+
+/* 버스 초기화 */
+void SPI_Bus_Init(SPI_Bus *bus)
+{
+    /* 널 포인터 체크 */
+    assert(bus != NULL);
+    assert(bus->Instance != NULL);
+
+    bus->pCurrent = NULL;
+}
+
+/* 장치 등록 */
+void SPI_Bus_AddDevice(SPI_Bus *bus, SPI_Device *dev)
+{
+    /* 널 포인터 체크 */
+    assert(bus != NULL);
+    assert(dev != NULL);
+    assert(dev->CSPort != NULL);
+    /* 핀 번호 체크 */
+    assert(dev->CSPin <= 15);
+
+    GPIO_Config gpio_config = {
+        .Pin = dev->CSPin,
+        .Mode = GPIO_MODE_OUTPUT,
+        .Otype = GPIO_OTYPE_PUSHPULL,
+        .Speed = GPIO_SPEED_HIGH,
+        .PuPd = GPIO_PUPD_NONE
+    };
+
+    /* 레지스터 값 미리 계산 */
+    SPI_BuildConfig(bus->Instance, &dev->Config, &dev->CR1, &dev->CR2);
+    dev->CRCPR = dev->Config.CRCPolynomial ? dev->Config.CRCPolynomial : SPI_CRC_POLYNOMIAL_DEFAULT;
+    dev->CSRelease = 1U << dev->CSPin;
+    dev->CSAssert = dev->CSRelease << 16;
+
+    /* 칩 셀렉트를 비활성(High) 상태로 먼저 출력한 뒤 출력 모드로 전환 */
+    dev->CSPort->BSRR = dev->CSRelease;
+    GPIO_Init(dev->CSPort, &gpio_config);
+
+    /* 설정이 바뀌었을 수 있으므로 다음 선택 시 다시 적용 */
+    if (bus->pCurrent == dev)
+    {
+        bus->pCurrent = NULL;
+    }
+}
+
+/* 캐시 무효화 */
+void SPI_Bus_Invalidate(SPI_Bus *bus)
+{
+    /* 널 포인터 체크 */
+    assert(bus != NULL);
+
+    bus->pCurrent = NULL;
+}
+
+/* 장치 선택 */
+SPI_Status SPI_Bus_Select(SPI_Bus *bus, SPI_Device *dev)
+{
+    /* 널 포인터 체크 */
+    assert(bus != NULL);
+    assert(dev != NULL);
+
+    SPI_TypeDef *SPIx = bus->Instance;
+    SPI_CR1_TypeDef cr1 = {.w = dev->CR1};
+    uint32_t timeout = SPI_TIMEOUT_DEFAULT;
+
+    if (bus->pCurrent == dev)
+    {
+        return SPI_OK;
+    }
+
+    /* 첫 선택은 클럭 활성화를 포함한 전체 초기화 */
+    if (bus->pCurrent == NULL)
+    {
+        SPI_Init(SPIx, &dev->Config);
+        bus->pCurrent = dev;
+        return SPI_OK;
+    }
+
+    /* 전송 중에는 CPOL/CPHA/BR을 바꿀 수 없으므로 이전 프레임 종료 대기 */
+    while (SPIx->SR.b.BSY)
+    {
+        if (--timeout == 0)
+        {
+            return SPI_TIMEOUT;
+        }
+    }
+
+    if (dev->CR2 != bus->pCurrent->CR2)
+    {
+        SPIx->CR2.w = dev->CR2;
+    }
+
+    /* DFF, CRCEN, CRC 다항식은 SPE=0이 이미 적용된 상태에서만 변경 - SPE를 먼저 끈 뒤 새 설정 기록 */
+    if (cr1.b.DFF != SPIx->CR1.b.DFF || cr1.b.CRCEN != SPIx->CR1.b.CRCEN ||
+        (cr1.b.CRCEN && dev->CRCPR != SPIx->CRCPR))
+    {
+        SPIx->CR1.b.SPE = 0;
+        cr1.b.SPE = 0;
+        SPIx->CR1.w = cr1.w;
+        SPIx->CRCPR = dev->CRCPR;
+    }
+
+    SPIx->CR1.w = dev->CR1;
+    bus->pCurrent = dev;
+
+    return SPI_OK;
+}
+
+/* 장치 선택 및 칩 셀렉트 활성화 */
+SPI_Status SPI_Bus_Begin(SPI_Bus *bus, SPI_Device *dev)
+{
+    SPI_Status status = SPI_Bus_Select(bus, dev);
+    if (status != SPI_OK)
+    {
+        return status;
+    }
+
+    dev->CSPort->BSRR = dev->CSAssert;
+
+    return SPI_OK;
+}
+
+/* 칩 셀렉트 비활성화 */
+void SPI_Bus_End(SPI_Bus *bus)
+{
+    /* 널 포인터 체크 */
+    assert(bus != NULL);
+    assert(bus->pCurrent != NULL);
+
+    bus->pCurrent->CSPort->BSRR = bus->pCurrent->CSRelease;
+}
+
+/* 칩 셀렉트 구간 송수신 */
+SPI_Status SPI_Bus_Transfer(SPI_Bus *bus, SPI_Device *dev, uint8_t *txData, uint8_t *rxData, uint16_t len)
+{
+    SPI_Status status = SPI_Bus_Begin(bus, dev);
+    if (status != SPI_OK)
+    {
+        return status;
+    }
+
+    status = SPI_TransferData(bus->Instance, txData, rxData, len);
+    SPI_Bus_End(bus);
+
+    return status;
+}
+
+/* 칩 셀렉트 구간 쓰기 */
+SPI_Status SPI_Bus_Write(SPI_Bus *bus, SPI_Device *dev, uint8_t *data, uint16_t len)
+{
+    SPI_Status status = SPI_Bus_Begin(bus, dev);
+    if (status != SPI_OK)
+    {
+        return status;
+    }
+
+    status = SPI_WriteData(bus->Instance, data, len);
+    SPI_Bus_End(bus);
+
+    return status;
+}
+
+/* 칩 셀렉트 구간 명령 쓰기 후 읽기 */
+SPI_Status SPI_Bus_WriteRead(SPI_Bus *bus, SPI_Device *dev, uint8_t *cmd, uint16_t cmdLen, uint8_t *data, uint16_t len)
+{
+    SPI_Status status = SPI_Bus_Begin(bus, dev);
+    if (status != SPI_OK)
+    {
+        return status;
+    }
+
+    status = SPI_WriteData(bus->Instance, cmd, cmdLen);
+    if (status == SPI_OK)
+    {
+        status = SPI_ReadData(bus->Instance, data, len);
+    }
+    SPI_Bus_End(bus);
+
+    return status;
+}
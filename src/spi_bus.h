@@ -0,0 +1,118 @@
+#ifndef __SPI_BUS_H
+#define __SPI_BUS_H
+
+#include "spi.h"
+#include "gpio.h"
+
+/**
+ * @brief SPI 버스에 연결된 장치 디스크립터
+ * @note  Config, CSPort, CSPin은 사용자가 설정하고, 나머지 필드는 SPI_Bus_AddDevice()가 계산합니다.
+ */
+typedef struct
+{
+    SPI_Config    Config;    /*!< 장치의 SPI 설정 (모드, 속도, 데이터 크기 등) */
+    GPIO_TypeDef *CSPort;    /*!< 칩 셀렉트 GPIO 포트 */
+    uint8_t       CSPin;     /*!< 칩 셀렉트 핀 번호 (0-15, Active Low) */
+    uint32_t      CR1;       /*!< 미리 계산된 CR1 값 (SPE=1 포함) */
+    uint32_t      CR2;       /*!< 미리 계산된 CR2 값 */
+    uint16_t      CRCPR;     /*!< 미리 계산된 CRC 다항식 (CRC 사용 장치만 적용) */
+    uint32_t      CSAssert;  /*!< 칩 셀렉트 Low 출력용 BSRR 값 */
+    uint32_t      CSRelease; /*!< 칩 셀렉트 High 출력용 BSRR 값 */
+} SPI_Device;
+
+/**
+ * @brief 여러 장치를 공유하는 SPI 버스 관리 구조체
+ */
+typedef struct
+{
+    SPI_TypeDef *Instance; /*!< 버스로 사용하는 SPI 주변장치 */
+    SPI_Device  *pCurrent; /*!< 현재 레지스터에 적용된 장치 (캐시, NULL이면 미설정) */
+} SPI_Bus;
+
+/**
+ * @brief  SPI 버스 관리 구조체를 초기화합니다.
+ * @param  bus: 버스 구조체 포인터 (Instance 설정 후 호출)
+ * @return None
+ * @note   레지스터는 변경하지 않으며, 첫 번째 장치 선택 시 SPI_Init()으로 주변장치를 초기화합니다.
+ */
+void SPI_Bus_Init(SPI_Bus *bus);
+
+/**
+ * @brief  장치를 버스에 등록합니다.
+ * @param  bus: 버스 구조체 포인터
+ * @param  dev: 장치 디스크립터 포인터 (Config, CSPort, CSPin 설정 후 호출)
+ * @return None
+ * @note   장치의 CR1/CR2와 칩 셀렉트 BSRR 값을 미리 계산하고, 칩 셀렉트 핀을 High 출력으로 설정합니다.
+ *         장치 설정(Config)을 바꾸거나 시스템/버스 클럭을 변경한 경우 다시 호출해야 합니다.
+ */
+void SPI_Bus_AddDevice(SPI_Bus *bus, SPI_Device *dev);
+
+/**
+ * @brief  장치 설정 캐시를 무효화합니다.
+ * @param  bus: 버스 구조체 포인터
+ * @return None
+ * @note   버스 밖에서 SPI_Init() 등으로 레지스터를 변경한 경우 호출합니다.
+ */
+void SPI_Bus_Invalidate(SPI_Bus *bus);
+
+/**
+ * @brief  장치의 설정을 SPI 레지스터에 적용합니다 (칩 셀렉트는 변경하지 않음).
+ * @param  bus: 버스 구조체 포인터
+ * @param  dev: 선택할 장치
+ * @return SPI_Status: 선택 결과 (이전 전송이 끝나지 않으면 SPI_TIMEOUT)
+ * @note   이미 적용된 장치이면 레지스터를 쓰지 않습니다. 전환은 CR1 쓰기 한 번이며, DFF/CRC 설정이
+ *         다르거나 CR2가 다른 경우에만 SPE=0 및 CRCPR 쓰기 또는 CR2 쓰기가 추가됩니다.
+ */
+SPI_Status SPI_Bus_Select(SPI_Bus *bus, SPI_Device *dev);
+
+/**
+ * @brief  장치를 선택하고 칩 셀렉트를 활성화(Low)합니다.
+ * @param  bus: 버스 구조체 포인터
+ * @param  dev: 통신할 장치
+ * @return SPI_Status: 선택 결과
+ * @note   여러 번의 전송을 하나의 칩 셀렉트 구간으로 묶을 때 SPI_Bus_End()와 함께 사용합니다.
+ */
+SPI_Status SPI_Bus_Begin(SPI_Bus *bus, SPI_Device *dev);
+
+/**
+ * @brief  현재 장치의 칩 셀렉트를 비활성화(High)합니다.
+ * @param  bus: 버스 구조체 포인터
+ * @return None
+ * @warning 마지막 프레임 전송이 끝난 뒤(폴링 API 반환 후 또는 DMA/인터럽트 완료 콜백에서) 호출해야 합니다.
+ */
+void SPI_Bus_End(SPI_Bus *bus);
+
+/**
+ * @brief  장치와 데이터를 동시에 송수신합니다 (칩 셀렉트 자동 제어).
+ * @param  bus: 버스 구조체 포인터
+ * @param  dev: 통신할 장치
+ * @param  txData: 전송할 데이터 버퍼의 포인터
+ * @param  rxData: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 송수신할 데이터의 길이 (바이트)
+ * @return SPI_Status: 데이터 송수신 결과
+ */
+SPI_Status SPI_Bus_Transfer(SPI_Bus *bus, SPI_Device *dev, uint8_t *txData, uint8_t *rxData, uint16_t len);
+
+/**
+ * @brief  장치에 데이터를 씁니다 (칩 셀렉트 자동 제어).
+ * @param  bus: 버스 구조체 포인터
+ * @param  dev: 통신할 장치
+ * @param  data: 전송할 데이터 버퍼의 포인터
+ * @param  len: 전송할 데이터의 길이 (바이트)
+ * @return SPI_Status: 데이터 전송 결과
+ */
+SPI_Status SPI_Bus_Write(SPI_Bus *bus, SPI_Device *dev, uint8_t *data, uint16_t len);
+
+/**
+ * @brief  장치에 명령을 쓴 뒤 같은 칩 셀렉트 구간에서 데이터를 읽습니다.
+ * @param  bus: 버스 구조체 포인터
+ * @param  dev: 통신할 장치
+ * @param  cmd: 전송할 명령(및 주소) 버퍼의 포인터
+ * @param  cmdLen: 명령 길이 (바이트)
+ * @param  data: 수신한 데이터를 저장할 버퍼의 포인터
+ * @param  len: 수신할 데이터의 길이 (바이트)
+ * @return SPI_Status: 데이터 수신 결과
+ */
+SPI_Status SPI_Bus_WriteRead(SPI_Bus *bus, SPI_Device *dev, uint8_t *cmd, uint16_t cmdLen, uint8_t *data, uint16_t len);
+
+#endif /* __SPI_BUS_H */
@@ -0,0 +1,313 @@
+#include "spi_flash.h"
+#include <assert.h>
+
+/* SPI 인스턴스별 연속 읽기 중인 플래시 (스트림 콜백에서 플래시 구조체를 찾기 위함) */
+static SPI_Flash *spi_flash_stream[3];
+
+/* 연속 읽기 테이블 인덱스 반환 내부 함수 */
+static uint8_t SPI_Flash_StreamIndex(SPI_TypeDef *SPIx)
+{
+    if (SPIx == SPI1)
+        return 0;
+    if (SPIx == SPI2)
+        return 1;
+    return 2;
+}
+
+/* 명령 + 24비트 주소 전송 내부 함수 (칩 셀렉트는 호출자가 제어) */
+static SPI_Status SPI_Flash_SendCommand(SPI_Flash *flash, uint8_t cmd, uint32_t addr, uint8_t dummy)
+{
+    uint8_t header[5] = {cmd, (uint8_t)(addr >> 16), (uint8_t)(addr >> 8), (uint8_t)addr, 0xFF};
+
+    return SPI_WriteData(flash->pBus->Instance, header, dummy ? 5 : 4);
+}
+
+/* 쓰기 허용 내부 함수 */
+static SPI_Status SPI_Flash_WriteEnable(SPI_Flash *flash)
+{
+    uint8_t cmd = SPI_FLASH_CMD_WRITE_ENABLE;
+
+    return SPI_Bus_Write(flash->pBus, flash->pDevice, &cmd, 1);
+}
+
+/* 연속 읽기 블록 콜백 내부 함수 - 남은 블록 수를 세고 마지막 블록 후 중단 */
+static void SPI_Flash_StreamHandler(SPI_TypeDef *SPIx, uint8_t *data, uint16_t len, SPI_Status status)
+{
+    SPI_Flash *flash = spi_flash_stream[SPI_Flash_StreamIndex(SPIx)];
+    uint8_t last = 0;
+
+    if (flash == NULL)
+    {
+        return;
+    }
+
+    if (status != SPI_OK)
+    {
+        /* SPI 계층에서 DMA는 이미 중단됨 - 칩 셀렉트만 해제 */
+        spi_flash_stream[SPI_Flash_StreamIndex(SPIx)] = NULL;
+        flash->Streaming = 0;
+        SPI_Bus_End(flash->pBus);
+        flash->StreamCallback(flash, NULL, 0, status);
+        return;
+    }
+
+    if (flash->StreamBlocks > 0 && --flash->StreamBlocks == 0)
+    {
+        last = 1;
+    }
+
+    /* 마지막 블록이면 통지 전에 DMA를 멈춰 버퍼가 더 이상 바뀌지 않도록 함 */
+    if (last)
+    {
+        SPI_Flash_StopStream(flash);
+    }
+
+    flash->StreamCallback(flash, data, len, SPI_OK);
+}
+
+/* JEDEC ID 읽기 */
+SPI_Status SPI_Flash_ReadID(SPI_Flash *flash, uint8_t *id)
+{
+    /* 널 포인터 체크 */
+    assert(flash != NULL);
+    assert(id != NULL);
+
+    uint8_t cmd = SPI_FLASH_CMD_READ_ID;
+
+    return SPI_Bus_WriteRead(flash->pBus, flash->pDevice, &cmd, 1, id, 3);
+}
+
+/* WIP 폴링 */
+SPI_Status SPI_Flash_WaitReady(SPI_Flash *flash, uint32_t trials)
+{
+    /* 널 포인터 체크 */
+    assert(flash != NULL);
+    /* 폴링 횟수 체크 */
+    assert(trials > 0);
+
+    uint8_t cmd = SPI_FLASH_CMD_READ_STATUS;
+    uint8_t status_reg;
+    SPI_Status status = SPI_Bus_Begin(flash->pBus, flash->pDevice);
+    if (status != SPI_OK)
+    {
+        return status;
+    }
+
+    status = SPI_WriteData(flash->pBus->Instance, &cmd, 1);
+
+    /* 칩 셀렉트를 유지하면 플래시가 상태 레지스터를 반복해서 출력함 */
+    while (status == SPI_OK)
+    {
+        status = SPI_ReadData(flash->pBus->Instance, &status_reg, 1);
+        if (status != SPI_OK || !(status_reg & SPI_FLASH_STATUS_WIP))
+        {
+            break;
+        }
+        if (--trials == 0)
+        {
+            status = SPI_BUSY;
+        }
+    }
+
+    SPI_Bus_End(flash->pBus);
+
+    return status;
+}
+
+/* 고속 읽기 */
+SPI_Status SPI_Flash_Read(SPI_Flash *flash, uint32_t addr, uint8_t *data, uint32_t len)
+{
+    /* 널 포인터 체크 */
+    assert(flash != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    SPI_Status status;
+    uint16_t chunk;
+
+    if (addr + len > flash->Capacity)
+    {
+        return SPI_ERROR;
+    }
+
+    status = SPI_Bus_Begin(flash->pBus, flash->pDevice);
+    if (status != SPI_OK)
+    {
+        return status;
+    }
+
+    status = SPI_Flash_SendCommand(flash, SPI_FLASH_CMD_FAST_READ, addr, 1);
+
+    /* 주소는 플래시가 자동 증가 - 16비트 길이 제한만큼 나누어 같은 구간에서 계속 읽음 */
+    while (status == SPI_OK && len > 0)
+    {
+        chunk = (len > 0xFFFF) ? 0xFFFF : (uint16_t)len;
+        status = SPI_ReadData(flash->pBus->Instance, data, chunk);
+        data += chunk;
+        len -= chunk;
+    }
+
+    SPI_Bus_End(flash->pBus);
+
+    return status;
+}
+
+/* 페이지 단위 쓰기 */
+SPI_Status SPI_Flash_Write(SPI_Flash *flash, uint32_t addr, const uint8_t *data, uint32_t len)
+{
+    /* 널 포인터 체크 */
+    assert(flash != NULL);
+    assert(data != NULL);
+    /* 데이터 길이 체크 */
+    assert(len > 0);
+
+    SPI_Status status;
+    uint32_t chunk;
+
+    if (addr + len > flash->Capacity)
+    {
+        return SPI_ERROR;
+    }
+
+    while (len > 0)
+    {
+        /* 페이지 경계를 넘으면 같은 페이지의 앞부분에 이어 쓰므로 경계에서 나눔 */
+        chunk = SPI_FLASH_PAGE_SIZE - (addr % SPI_FLASH_PAGE_SIZE);
+        if (chunk > len)
+        {
+            chunk = len;
+        }
+
+        status = SPI_Flash_WriteEnable(flash);
+        if (status != SPI_OK)
+            return status;
+
+        status = SPI_Bus_Begin(flash->pBus, flash->pDevice);
+        if (status != SPI_OK)
+            return status;
+
+        status = SPI_Flash_SendCommand(flash, SPI_FLASH_CMD_PAGE_PROGRAM, addr, 0);
+        if (status == SPI_OK)
+        {
+            status = SPI_WriteData(flash->pBus->Instance, (uint8_t *)data, (uint16_t)chunk);
+        }
+
+        /* 칩 셀렉트 상승 에지에서 프로그램 시작 */
+        SPI_Bus_End(flash->pBus);
+        if (status != SPI_OK)
+            return status;
+
+        status = SPI_Flash_WaitReady(flash, SPI_FLASH_PROGRAM_POLL);
+        if (status != SPI_OK)
+            return status;
+
+        addr += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+
+    return SPI_OK;
+}
+
+/* 섹터 지우기 */
+SPI_Status SPI_Flash_EraseSector(SPI_Flash *flash, uint32_t addr)
+{
+    /* 널 포인터 체크 */
+    assert(flash != NULL);
+
+    SPI_Status status;
+
+    if (addr >= flash->Capacity)
+    {
+        return SPI_ERROR;
+    }
+
+    status = SPI_Flash_WriteEnable(flash);
+    if (status != SPI_OK)
+        return status;
+
+    status = SPI_Bus_Begin(flash->pBus, flash->pDevice);
+    if (status != SPI_OK)
+        return status;
+
+    status = SPI_Flash_SendCommand(flash, SPI_FLASH_CMD_SECTOR_ERASE, addr & ~(uint32_t)(SPI_FLASH_SECTOR_SIZE - 1), 0);
+    SPI_Bus_End(flash->pBus);
+    if (status != SPI_OK)
+        return status;
+
+    return SPI_Flash_WaitReady(flash, SPI_FLASH_ERASE_POLL);
+}
+
+/* 핑퐁 연속 읽기 시작 */
+SPI_Status SPI_Flash_StartStream(SPI_Flash *flash, uint32_t addr, uint8_t *buffer, uint16_t len, uint32_t blocks, SPI_FlashStreamCallback callback)
+{
+    /* 널 포인터 체크 */
+    assert(flash != NULL);
+    assert(buffer != NULL);
+    assert(callback != NULL);
+    /* 데이터 길이 체크 */
+    assert(len >= 2 && (len % 2) == 0);
+
+    SPI_TypeDef *SPIx = flash->pBus->Instance;
+    uint8_t index = SPI_Flash_StreamIndex(SPIx);
+    SPI_Status status;
+
+    if (addr >= flash->Capacity)
+    {
+        return SPI_ERROR;
+    }
+    if (flash->Streaming || spi_flash_stream[index] != NULL)
+    {
+        return SPI_BUSY;
+    }
+
+    status = SPI_Bus_Begin(flash->pBus, flash->pDevice);
+    if (status != SPI_OK)
+    {
+        return status;
+    }
+
+    status = SPI_Flash_SendCommand(flash, SPI_FLASH_CMD_FAST_READ, addr, 1);
+    if (status != SPI_OK)
+    {
+        SPI_Bus_End(flash->pBus);
+        return status;
+    }
+
+    flash->StreamBlocks = blocks;
+    flash->StreamCallback = callback;
+    flash->Streaming = 1;
+    spi_flash_stream[index] = flash;
+
+    status = SPI_ReadStream_DMA(SPIx, buffer, len, SPI_Flash_StreamHandler);
+    if (status != SPI_OK)
+    {
+        spi_flash_stream[index] = NULL;
+        flash->Streaming = 0;
+        SPI_Bus_End(flash->pBus);
+    }
+
+    return status;
+}
+
+/* 연속 읽기 중단 */
+void SPI_Flash_StopStream(SPI_Flash *flash)
+{
+    /* 널 포인터 체크 */
+    assert(flash != NULL);
+
+    SPI_TypeDef *SPIx = flash->pBus->Instance;
+
+    if (!flash->Streaming)
+    {
+        return;
+    }
+
+    SPI_StopStream_DMA(SPIx);
+    spi_flash_stream[SPI_Flash_StreamIndex(SPIx)] = NULL;
+    flash->Streaming = 0;
+
+    /* 칩 셀렉트 해제로 연속 읽기 명령 종료 */
+    SPI_Bus_End(flash->pBus);
+}
@@ -0,0 +1,134 @@
+#ifndef __SPI_FLASH_H
+#define __SPI_FLASH_H
+
+#include "spi_bus.h"
+
+/**
+ * @brief SPI NOR 플래시 명령어 (JEDEC 공통)
+ */
+#define SPI_FLASH_CMD_WRITE_ENABLE  0x06 /*!< 쓰기 허용 (WEL 설정) */
+#define SPI_FLASH_CMD_READ_STATUS   0x05 /*!< 상태 레지스터 1 읽기 */
+#define SPI_FLASH_CMD_PAGE_PROGRAM  0x02 /*!< 페이지 프로그램 */
+#define SPI_FLASH_CMD_SECTOR_ERASE  0x20 /*!< 4KB 섹터 지우기 */
+#define SPI_FLASH_CMD_FAST_READ     0x0B /*!< 고속 읽기 (더미 1바이트) */
+#define SPI_FLASH_CMD_READ_ID       0x9F /*!< JEDEC ID 읽기 */
+
+/**
+ * @brief 상태 레지스터 WIP(Write In Progress) 비트
+ */
+#define SPI_FLASH_STATUS_WIP 0x01
+
+/**
+ * @brief 플래시 구조 정의
+ */
+#define SPI_FLASH_PAGE_SIZE   256  /*!< 페이지 프로그램 단위 (바이트) */
+#define SPI_FLASH_SECTOR_SIZE 4096 /*!< 섹터 지우기 단위 (바이트) */
+
+/**
+ * @brief WIP 폴링 최대 횟수 (상태 레지스터 읽기 횟수)
+ */
+#define SPI_FLASH_PROGRAM_POLL 100000   /*!< 페이지 프로그램 (일반적으로 최대 3ms) */
+#define SPI_FLASH_ERASE_POLL   10000000 /*!< 섹터 지우기 (일반적으로 최대 400ms) */
+
+struct __SPI_Flash;
+
+/**
+ * @brief 플래시 연속 읽기 콜백 함수 타입
+ * @param flash: 연속 읽기 중인 플래시 장치
+ * @param data: 읽은 데이터 블록 (핑퐁 버퍼의 한쪽 절반, 오류 시 NULL)
+ * @param len: 블록 크기 (바이트, 오류 시 0)
+ * @param status: SPI_OK 또는 SPI_ERROR (연속 읽기가 중단됨)
+ */
+typedef void (*SPI_FlashStreamCallback)(struct __SPI_Flash *flash, uint8_t *data, uint16_t len, SPI_Status status);
+
+/**
+ * @brief SPI NOR 플래시 장치 구조체
+ * @note  pBus, pDevice, Capacity는 사용자가 설정합니다. 장치는 SPI_Bus_AddDevice()로 등록되어 있어야 하며
+ *        8비트 프레임(DataSize = 0)을 사용해야 합니다.
+ */
+typedef struct __SPI_Flash
+{
+    SPI_Bus    *pBus;      /*!< 플래시가 연결된 SPI 버스 */
+    SPI_Device *pDevice;   /*!< 플래시 장치 디스크립터 (칩 셀렉트 포함) */
+    uint32_t    Capacity;  /*!< 전체 용량 (바이트, 24비트 주소 범위 이내) */
+    volatile uint32_t StreamBlocks; /*!< 연속 읽기에서 남은 블록 수 (0이면 중단할 때까지 계속) */
+    volatile uint8_t  Streaming;    /*!< 연속 읽기 진행 중 여부 */
+    SPI_FlashStreamCallback StreamCallback; /*!< 연속 읽기 블록 콜백 */
+} SPI_Flash;
+
+/**
+ * @brief  플래시의 JEDEC ID를 읽습니다.
+ * @param  flash: 플래시 장치 구조체 포인터
+ * @param  id: ID를 저장할 3바이트 버퍼 (제조사, 메모리 타입, 용량)
+ * @return SPI_Status: 읽기 결과
+ */
+SPI_Status SPI_Flash_ReadID(SPI_Flash *flash, uint8_t *id);
+
+/**
+ * @brief  진행 중인 프로그램/지우기가 끝날 때까지 WIP 비트를 폴링합니다.
+ * @param  flash: 플래시 장치 구조체 포인터
+ * @param  trials: 상태 레지스터를 읽는 최대 횟수
+ * @return SPI_Status: SPI_OK(준비됨) 또는 SPI_BUSY(trials 초과)
+ * @note   칩 셀렉트를 유지한 채 상태 레지스터를 연속으로 읽으므로 명령을 반복해서 보내지 않습니다.
+ */
+SPI_Status SPI_Flash_WaitReady(SPI_Flash *flash, uint32_t trials);
+
+/**
+ * @brief  플래시에서 데이터를 읽습니다 (고속 읽기 0x0B).
+ * @param  flash: 플래시 장치 구조체 포인터
+ * @param  addr: 시작 주소
+ * @param  data: 읽은 데이터를 저장할 버퍼의 포인터
+ * @param  len: 읽을 데이터의 길이 (바이트)
+ * @return SPI_Status: 읽기 결과 (범위를 벗어나면 SPI_ERROR)
+ * @note   하나의 칩 셀렉트 구간에서 끝까지 연속으로 읽습니다.
+ */
+SPI_Status SPI_Flash_Read(SPI_Flash *flash, uint32_t addr, uint8_t *data, uint32_t len);
+
+/**
+ * @brief  플래시에 데이터를 씁니다 (페이지 프로그램 0x02).
+ * @param  flash: 플래시 장치 구조체 포인터
+ * @param  addr: 시작 주소
+ * @param  data: 쓸 데이터 버퍼의 포인터
+ * @param  len: 쓸 데이터의 길이 (바이트)
+ * @return SPI_Status: 쓰기 결과 (범위를 벗어나면 SPI_ERROR, 프로그램이 끝나지 않으면 SPI_BUSY)
+ * @note   페이지 경계에서 자동으로 나누어 쓰고, 페이지마다 WIP 폴링으로 완료를 확인한 뒤 다음 페이지를 씁니다.
+ * @warning 대상 영역은 미리 지워져(0xFF) 있어야 합니다.
+ */
+SPI_Status SPI_Flash_Write(SPI_Flash *flash, uint32_t addr, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief  4KB 섹터를 지웁니다 (0x20).
+ * @param  flash: 플래시 장치 구조체 포인터
+ * @param  addr: 지울 섹터 안의 주소
+ * @return SPI_Status: 지우기 결과 (범위를 벗어나면 SPI_ERROR, 지우기가 끝나지 않으면 SPI_BUSY)
+ * @note   지우기가 끝날 때까지 WIP 폴링으로 대기합니다.
+ */
+SPI_Status SPI_Flash_EraseSector(SPI_Flash *flash, uint32_t addr);
+
+/**
+ * @brief  핑퐁 버퍼로 연속 읽기를 시작합니다 (고속 읽기 0x0B + 순환 DMA).
+ * @param  flash: 플래시 장치 구조체 포인터
+ * @param  addr: 시작 주소
+ * @param  buffer: 핑퐁 버퍼 (두 절반을 번갈아 사용)
+ * @param  len: 버퍼 크기 (바이트, 짝수)
+ * @param  blocks: 읽을 블록(버퍼 절반) 수 (0이면 SPI_Flash_StopStream() 호출까지 계속)
+ * @param  callback: 블록이 채워질 때마다 호출될 콜백 함수
+ * @return SPI_Status: 시작 결과
+ * @note   명령과 주소를 보낸 뒤 칩 셀렉트를 유지한 채 SPI_ReadStream_DMA()로 클럭을 계속 생성합니다.
+ *         플래시는 주소를 자동 증가시키므로 명령을 다시 보내지 않고 끝까지 읽습니다. DMA가 한쪽 절반을
+ *         채우는 동안 콜백에서 다른 절반을 처리할 수 있으며, 마지막 블록 콜백 후 자동으로 중단됩니다.
+ * @warning
+ *         - 연속 읽기 중에는 같은 버스의 다른 장치와 통신할 수 없습니다.
+ *         - 콜백은 블록 하나의 전송 시간 안에 처리를 끝내야 합니다.
+ */
+SPI_Status SPI_Flash_StartStream(SPI_Flash *flash, uint32_t addr, uint8_t *buffer, uint16_t len, uint32_t blocks, SPI_FlashStreamCallback callback);
+
+/**
+ * @brief  연속 읽기를 중단합니다.
+ * @param  flash: 플래시 장치 구조체 포인터
+ * @return None
+ * @note   DMA를 멈추고 칩 셀렉트를 해제합니다. 콜백 안에서 호출해도 됩니다.
+ */
+void SPI_Flash_StopStream(SPI_Flash *flash);
+
+#endif /* __SPI_FLASH_H */
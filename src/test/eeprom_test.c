@@ -0,0 +1,86 @@
+#include "../eeprom.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 테스트 결과를 출력하는 헬퍼 함수
+ */
+static void PrintTestResult(const char* test_name, I2C_Status status) {
+    if (status == I2C_OK) {
+        printf("%s: 성공\n", test_name);
+    } else {
+        printf("%s: 실패 (상태: %d)\n", test_name, status);
+    }
+}
+
+/* 테스트용 24C256 (32KB, 64바이트 페이지) */
+static EEPROM_Device eeprom = {
+    .Instance = I2C1,
+    .DevAddress = 0x50,
+    .MemAddSize = I2C_MEMADD_SIZE_16BIT,
+    .PageSize = 64,
+    .Capacity = 32768,
+    .PollTrials = 1000
+};
+
+/**
+ * @brief EEPROM 페이지 쓰기 및 읽기 테스트
+ */
+static void Test_EEPROM_Functions(void) {
+    printf("\n=== EEPROM 페이지 쓰기 테스트 ===\n");
+    
+    static uint8_t tx_data[200];
+    static uint8_t rx_data[200];
+    
+    for (int i = 0; i < (int)sizeof(tx_data); i++) {
+        tx_data[i] = (uint8_t)i;
+    }
+    
+    // 페이지 경계에 걸친 쓰기 (0x0030-0x00F7: 4개 페이지로 분할)
+    I2C_Status status = EEPROM_Write(&eeprom, 0x0030, tx_data, sizeof(tx_data));
+    PrintTestResult("페이지 경계 쓰기", status);
+    
+    status = EEPROM_Read(&eeprom, 0x0030, rx_data, sizeof(rx_data));
+    PrintTestResult("순차 읽기", status);
+    
+    if (status == I2C_OK) {
+        printf("데이터 비교: %s\n", memcmp(tx_data, rx_data, sizeof(tx_data)) == 0 ? "일치" : "불일치");
+    }
+    
+    // 용량을 벗어난 쓰기
+    status = EEPROM_Write(&eeprom, 32760, tx_data, 16);
+    printf("범위 밖 쓰기: %s\n", status == I2C_ERROR ? "거부됨" : "실패");
+    
+    // ACK 폴링
+    status = EEPROM_WaitReady(&eeprom);
+    PrintTestResult("ACK 폴링", status);
+}
+
+void EEPROM_Test(void) {
+    printf("===== EEPROM 드라이버 테스트 시작 =====\n");
+    
+    // I2C1 GPIO 설정 (PB6=SCL, PB7=SDA, AF4) - I2C_Test()가 끝에서 I2C1을 비활성화하므로 다시 초기화
+    GPIO_Config gpio_config = {
+        .Mode = GPIO_MODE_ALT,
+        .Otype = GPIO_OTYPE_OPENDRAIN,
+        .Speed = GPIO_SPEED_HIGH,
+        .PuPd = GPIO_PUPD_PULLUP,
+        .AF = GPIO_AF4
+    };
+    gpio_config.Pin = 6;  // PB6
+    GPIO_Init(GPIOB, &gpio_config);
+    gpio_config.Pin = 7;  // PB7
+    GPIO_Init(GPIOB, &gpio_config);
+    
+    I2C_Config i2c_config = {
+        .ClockSpeed = 400000,
+        .OwnAddress = 0x42
+    };
+    I2C_Init(I2C1, &i2c_config);
+    
+    Test_EEPROM_Functions();
+    
+    I2C_DeInit(I2C1);
+    
+    printf("\n===== EEPROM 드라이버 테스트 완료 =====\n");
+}
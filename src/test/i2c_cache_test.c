@@ -0,0 +1,95 @@
+#include "../i2c_cache.h"
+#include <stdio.h>
+
+/**
+ * @brief 테스트 결과를 출력하는 헬퍼 함수
+ */
+static void PrintTestResult(const char* test_name, I2C_Status status) {
+    if (status == I2C_OK) {
+        printf("%s: 성공\n", test_name);
+    } else {
+        printf("%s: 실패 (상태: %d)\n", test_name, status);
+    }
+}
+
+/* 테스트용 센서 레지스터 캐시 (0x20-0x3F, 0x27 상태 레지스터는 휘발성) */
+static uint8_t sensor_shadow[32];
+static uint8_t sensor_dirty[I2C_CACHE_BITMAP_SIZE(32)];
+static uint8_t sensor_valid[I2C_CACHE_BITMAP_SIZE(32)];
+static const uint8_t sensor_volatile[I2C_CACHE_BITMAP_SIZE(32)] = {0x80, 0x00, 0x00, 0x00};
+
+static I2C_Cache sensor_cache = {
+    .Instance = I2C1,
+    .SlaveAddr = 0x19,
+    .MemAddSize = I2C_MEMADD_SIZE_8BIT,
+    .BaseAddr = 0x20,
+    .Size = 32,
+    .MaxBurst = 0,
+    .pShadow = sensor_shadow,
+    .pDirty = sensor_dirty,
+    .pValid = sensor_valid,
+    .pVolatile = sensor_volatile
+};
+
+/**
+ * @brief 캐시 읽기/쓰기 테스트
+ */
+static void Test_I2C_Cache_Functions(void) {
+    printf("\n=== 레지스터 캐시 테스트 ===\n");
+    
+    uint8_t data[4];
+    I2C_Cache_Init(&sensor_cache);
+    
+    // 전체 블록 동기화
+    I2C_Status status = I2C_Cache_Sync(&sensor_cache);
+    PrintTestResult("레지스터 블록 동기화", status);
+    
+    // 캐시된 읽기 (버스 트래픽 없음)
+    status = I2C_Cache_Read(&sensor_cache, 0x20, data, 4);
+    PrintTestResult("캐시 읽기", status);
+    
+    // 휘발성 상태 레지스터 읽기 (항상 장치에서 읽음)
+    status = I2C_Cache_Read(&sensor_cache, 0x27, data, 1);
+    PrintTestResult("휘발성 레지스터 읽기", status);
+    
+    // 비트 변경 두 번 후 한 번의 버스트로 반영
+    status = I2C_Cache_UpdateBits(&sensor_cache, 0x20, 0x07, 0x07);
+    PrintTestResult("비트 변경 (0x20)", status);
+    status = I2C_Cache_UpdateBits(&sensor_cache, 0x23, 0x30, 0x10);
+    PrintTestResult("비트 변경 (0x23)", status);
+    status = I2C_Cache_Flush(&sensor_cache);
+    PrintTestResult("dirty 레지스터 반영", status);
+    
+    // 범위를 벗어난 접근
+    status = I2C_Cache_Read(&sensor_cache, 0x40, data, 1);
+    printf("범위 밖 읽기: %s\n", status == I2C_ERROR ? "거부됨" : "실패");
+}
+
+void I2C_Cache_Test(void) {
+    printf("===== I2C 레지스터 캐시 테스트 시작 =====\n");
+    
+    // I2C1 GPIO 설정 (PB6=SCL, PB7=SDA, AF4) - I2C_Test()가 끝에서 I2C1을 비활성화하므로 다시 초기화
+    GPIO_Config gpio_config = {
+        .Mode = GPIO_MODE_ALT,
+        .Otype = GPIO_OTYPE_OPENDRAIN,
+        .Speed = GPIO_SPEED_HIGH,
+        .PuPd = GPIO_PUPD_PULLUP,
+        .AF = GPIO_AF4
+    };
+    gpio_config.Pin = 6;  // PB6
+    GPIO_Init(GPIOB, &gpio_config);
+    gpio_config.Pin = 7;  // PB7
+    GPIO_Init(GPIOB, &gpio_config);
+    
+    I2C_Config i2c_config = {
+        .ClockSpeed = 400000,
+        .OwnAddress = 0x42
+    };
+    I2C_Init(I2C1, &i2c_config);
+    
+    Test_I2C_Cache_Functions();
+    
+    I2C_DeInit(I2C1);
+    
+    printf("\n===== I2C 레지스터 캐시 테스트 완료 =====\n");
+}
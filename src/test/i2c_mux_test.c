@@ -0,0 +1,116 @@
+#include "../i2c_mux.h"
+#include <stdio.h>
+
+/**
+ * @brief 테스트 결과를 출력하는 헬퍼 함수
+ */
+static void PrintTestResult(const char* test_name, I2C_Status status) {
+    if (status == I2C_OK) {
+        printf("%s: 성공\n", test_name);
+    } else {
+        printf("%s: 실패 (상태: %d)\n", test_name, status);
+    }
+}
+
+static I2C_Mux mux = {
+    .Instance = I2C1,
+    .MuxAddress = 0x70
+};
+
+/**
+ * @brief 채널 선택 및 캐시 테스트
+ */
+static void Test_I2C_Mux_Functions(void) {
+    printf("\n=== I2C 멀티플렉서 테스트 ===\n");
+    
+    uint8_t reg = 0x00;
+    uint8_t value[2];
+    
+    I2C_Mux_Init(&mux);
+    
+    I2C_Status status = I2C_Mux_Select(&mux, 3);
+    PrintTestResult("채널 3 선택", status);
+    
+    // 같은 채널 재선택은 버스 트랜잭션 없이 완료
+    status = I2C_Mux_Select(&mux, 3);
+    PrintTestResult("채널 3 재선택 (캐시)", status);
+    
+    status = I2C_Mux_WriteData(&mux, 3, 0x48, &reg, 1);
+    PrintTestResult("채널 3 장치 쓰기", status);
+    status = I2C_Mux_ReadData(&mux, 3, 0x48, value, 2);
+    PrintTestResult("채널 3 장치 읽기", status);
+    
+    status = I2C_Mux_Disable(&mux);
+    PrintTestResult("모든 채널 해제", status);
+}
+
+/**
+ * @brief 채널별 요청 큐 실행 테스트
+ */
+static void Test_I2C_Mux_Queue_Functions(void) {
+    printf("\n=== 멀티플렉서 요청 큐 테스트 ===\n");
+    
+    static uint8_t reg = 0x00;
+    static uint8_t temp[8][2];
+    static I2C_MuxRequest queue[8];
+    
+    // 같은 주소의 센서 8개를 채널 순서와 다르게 등록
+    const uint8_t order[8] = {5, 1, 5, 2, 1, 7, 2, 0};
+    for (int i = 0; i < 8; i++) {
+        queue[i].Channel = order[i];
+        queue[i].Xfer = (I2C_Transaction){.DevAddress = 0x48, .pTxBuffer = &reg, .TxSize = 1, .pRxBuffer = temp[i], .RxSize = 2};
+    }
+    
+    // 현재 채널 2부터 시작하여 채널 순으로 순환, 같은 채널 안에서는 등록 순서 유지
+    const uint8_t expected[8] = {2, 2, 5, 5, 7, 0, 1, 1};
+    I2C_Status select_status = I2C_Mux_Select(&mux, 2);
+    PrintTestResult("채널 2 선택", select_status);
+    
+    I2C_Status status = I2C_Mux_RunQueue(&mux, queue, 8);
+    PrintTestResult("요청 큐 실행", status);
+    
+    int errors = 0;
+    printf("실행 순서 (채널):");
+    for (int i = 0; i < 8; i++) {
+        printf(" %d", queue[i].Channel);
+        if (queue[i].Channel != expected[i]) {
+            errors++;
+        }
+    }
+    printf("\n");
+    
+    // 채널 2 선택이 실패하면 캐시가 무효이므로 채널 0부터 정렬됨
+    if (select_status == I2C_OK) {
+        printf("실행 순서 비교: %s (불일치 %d개)\n", errors == 0 ? "성공" : "실패", errors);
+    }
+}
+
+void I2C_Mux_Test(void) {
+    printf("===== I2C 멀티플렉서 테스트 시작 =====\n");
+    
+    // I2C1 GPIO 설정 (PB6=SCL, PB7=SDA, AF4) - I2C_Test()가 끝에서 I2C1을 비활성화하므로 다시 초기화
+    GPIO_Config gpio_config = {
+        .Mode = GPIO_MODE_ALT,
+        .Otype = GPIO_OTYPE_OPENDRAIN,
+        .Speed = GPIO_SPEED_HIGH,
+        .PuPd = GPIO_PUPD_PULLUP,
+        .AF = GPIO_AF4
+    };
+    gpio_config.Pin = 6;  // PB6
+    GPIO_Init(GPIOB, &gpio_config);
+    gpio_config.Pin = 7;  // PB7
+    GPIO_Init(GPIOB, &gpio_config);
+    
+    I2C_Config i2c_config = {
+        .ClockSpeed = 100000,
+        .OwnAddress = 0x42
+    };
+    I2C_Init(I2C1, &i2c_config);
+    
+    Test_I2C_Mux_Functions();
+    Test_I2C_Mux_Queue_Functions();
+    
+    I2C_DeInit(I2C1);
+    
+    printf("\n===== I2C 멀티플렉서 테스트 완료 =====\n");
+}
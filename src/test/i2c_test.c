@@ -1,4 +1,5 @@
 #include "../i2c.h"
+#include "../i2c_dualbus.h"
 #include "../gpio.h"
 #include <stdio.h>
 
@@ -97,6 +98,414 @@ static void Test_I2C_Data_Functions(I2C_TypeDef* I2Cx) {
     
     status = I2C_ReadData(I2Cx, slave_addr, rx_data, sizeof(rx_data));
     PrintTestResult("다중 바이트 읽기", status);
+    
+    // 레지스터 주소 기반 송수신 테스트 (반복 시작 조건)
+    printf("\n레지스터 송수신 테스트...\n");
+    status = I2C_MemWrite(I2Cx, slave_addr, 0x0010, I2C_MEMADD_SIZE_16BIT, tx_data, sizeof(tx_data));
+    PrintTestResult("16비트 주소 레지스터 쓰기", status);
+    
+    status = I2C_MemRead(I2Cx, slave_addr, 0x0010, I2C_MEMADD_SIZE_16BIT, rx_data, sizeof(rx_data));
+    PrintTestResult("16비트 주소 레지스터 읽기", status);
+    
+    status = I2C_MemRead(I2Cx, slave_addr, 0x10, I2C_MEMADD_SIZE_8BIT, rx_data, 1);
+    PrintTestResult("8비트 주소 레지스터 읽기", status);
+}
+
+static volatile uint8_t dma_done;
+static volatile I2C_Status dma_status;
+
+/**
+ * @brief I2C DMA 전송 완료 콜백
+ */
+static void DMA_Complete(I2C_TypeDef* I2Cx, I2C_Status status) {
+    (void)I2Cx;
+    dma_status = status;
+    dma_done = 1;
+}
+
+/**
+ * @brief DMA 전송 완료를 제한 시간 동안 기다리는 헬퍼 함수 (시간 초과 시 전송 중단)
+ */
+static I2C_Status WaitDMA(I2C_TypeDef* I2Cx) {
+    uint32_t wait = 10000000;
+    while (!dma_done && --wait);
+    if (!dma_done) {
+        I2C_AbortDMA(I2Cx);
+        return I2C_TIMEOUT;
+    }
+    return dma_status;
+}
+
+/* NVIC 인터럽트 번호 (RM0383 벡터 테이블) */
+#define DMA1_STREAM0_IRQ_NUMBER 11
+#define DMA1_STREAM6_IRQ_NUMBER 17
+#define I2C1_EV_IRQ_NUMBER      31
+#define I2C1_ER_IRQ_NUMBER      32
+
+/**
+ * @brief NVIC 인터럽트를 활성화하는 헬퍼 함수 (ISER 직접 쓰기)
+ */
+static void EnableIRQ(uint8_t irqn) {
+    volatile uint32_t* iser = (volatile uint32_t*)0xE000E100UL;
+    iser[irqn >> 5] = 1UL << (irqn & 0x1F);
+}
+
+/**
+ * @brief I2C1 DMA 스트림 인터럽트 벡터 (TX: Stream6, RX: Stream0)
+ */
+void DMA1_Stream6_IRQHandler(void) {
+    I2C_DMA_IRQHandler(I2C1);
+}
+
+void DMA1_Stream0_IRQHandler(void) {
+    I2C_DMA_IRQHandler(I2C1);
+}
+
+/**
+ * @brief I2C DMA 송수신 테스트
+ */
+static void Test_I2C_DMA_Functions(I2C_TypeDef* I2Cx) {
+    printf("\n=== DMA 송수신 테스트 ===\n");
+    
+    uint8_t slave_addr = 0x50;
+    uint8_t tx_data[] = {0x10, 0x20, 0x30, 0x40};
+    uint8_t rx_data[4];
+    I2C_Status status;
+    
+    // DMA 완료는 스트림 인터럽트, BTF 완료와 NACK/중재 손실은 I2C1 이벤트/에러 인터럽트로 통지
+    EnableIRQ(DMA1_STREAM6_IRQ_NUMBER);
+    EnableIRQ(DMA1_STREAM0_IRQ_NUMBER);
+    EnableIRQ(I2C1_EV_IRQ_NUMBER);
+    EnableIRQ(I2C1_ER_IRQ_NUMBER);
+    
+    dma_done = 0;
+    status = I2C_WriteData_DMA(I2Cx, slave_addr, tx_data, sizeof(tx_data), DMA_Complete);
+    if (status == I2C_OK) {
+        status = WaitDMA(I2Cx);
+    }
+    PrintTestResult("DMA 다중 바이트 쓰기", status);
+    
+    dma_done = 0;
+    status = I2C_ReadData_DMA(I2Cx, slave_addr, rx_data, sizeof(rx_data), DMA_Complete);
+    if (status == I2C_OK) {
+        status = WaitDMA(I2Cx);
+    }
+    PrintTestResult("DMA 다중 바이트 읽기", status);
+}
+
+static I2C_Handle hi2c1_test;
+static volatile uint8_t it_done;
+
+/**
+ * @brief I2C1 이벤트/에러 인터럽트 벡터 (DMA 전송과 인터럽트 전송 공용)
+ */
+void I2C1_EV_IRQHandler(void) {
+    I2C_DMA_IRQHandler(I2C1);
+    if (hi2c1_test.Instance != NULL) {
+        I2C_EV_IRQHandler(&hi2c1_test);
+    }
+}
+
+void I2C1_ER_IRQHandler(void) {
+    I2C_DMA_IRQHandler(I2C1);
+    if (hi2c1_test.Instance != NULL) {
+        I2C_ER_IRQHandler(&hi2c1_test);
+    }
+}
+
+/**
+ * @brief 인터럽트 전송 완료/오류 콜백
+ */
+static void IT_Complete(I2C_Handle* hi2c) {
+    (void)hi2c;
+    it_done = 1;
+}
+
+/**
+ * @brief 인터럽트 전송 완료를 제한 시간 동안 기다리는 헬퍼 함수 (시간 초과 시 전송 중단)
+ */
+static I2C_Status WaitIT(I2C_Handle* hi2c) {
+    uint32_t wait = 10000000;
+    while (!it_done && --wait);
+    if (!it_done) {
+        // 인터럽트를 끄고 버스를 해제해 이후 _IT/배치 요청이 BUSY로 거부되지 않도록 함
+        hi2c->Instance->CR2.b.ITEVTEN = 0;
+        hi2c->Instance->CR2.b.ITBUFEN = 0;
+        hi2c->Instance->CR2.b.ITERREN = 0;
+        I2C_Stop(hi2c->Instance);
+        hi2c->State = I2C_STATE_READY;
+        hi2c->ErrorCode = I2C_TIMEOUT;
+        return I2C_TIMEOUT;
+    }
+    return hi2c->ErrorCode;
+}
+
+/**
+ * @brief I2C 인터럽트 송수신 테스트
+ */
+static void Test_I2C_IT_Functions(I2C_TypeDef* I2Cx) {
+    printf("\n=== 인터럽트 송수신 테스트 ===\n");
+    
+    uint8_t slave_addr = 0x50;
+    uint8_t tx_data[] = {0x5A, 0xA5, 0x3C};
+    uint8_t rx_data[3];
+    I2C_Status status;
+    
+    hi2c1_test.Instance = I2Cx;
+    hi2c1_test.Config = (I2C_Config){
+        .ClockSpeed = 100000,
+        .OwnAddress = 0x42,
+        .DutyCycle = 0,
+        .GeneralCall = 0,
+        .NoStretchMode = 0
+    };
+    hi2c1_test.XferCpltCallback = IT_Complete;
+    hi2c1_test.ErrorCallback = IT_Complete;
+    I2C_InitHandle(&hi2c1_test);
+    EnableIRQ(I2C1_EV_IRQ_NUMBER);
+    EnableIRQ(I2C1_ER_IRQ_NUMBER);
+    
+    it_done = 0;
+    status = I2C_WriteData_IT(&hi2c1_test, slave_addr, tx_data, sizeof(tx_data));
+    if (status == I2C_OK) {
+        status = WaitIT(&hi2c1_test);
+    }
+    PrintTestResult("인터럽트 다중 바이트 쓰기", status);
+    
+    it_done = 0;
+    status = I2C_ReadData_IT(&hi2c1_test, slave_addr, rx_data, sizeof(rx_data));
+    if (status == I2C_OK) {
+        status = WaitIT(&hi2c1_test);
+    }
+    PrintTestResult("인터럽트 다중 바이트 읽기", status);
+    
+    // 배치 전송 테스트 (여러 장치를 반복 시작 조건으로 연속 실행)
+    uint8_t reg_a = 0x00, reg_b = 0x10;
+    uint8_t val_a[2], val_b[1];
+    I2C_Transaction batch[] = {
+        {.DevAddress = 0x50, .pTxBuffer = &reg_a, .TxSize = 1, .pRxBuffer = val_a, .RxSize = 2},
+        {.DevAddress = 0x51, .pTxBuffer = &reg_b, .TxSize = 1, .pRxBuffer = val_b, .RxSize = 1},
+        {.DevAddress = 0x52, .pTxBuffer = tx_data, .TxSize = sizeof(tx_data)}
+    };
+    
+    it_done = 0;
+    status = I2C_SubmitBatch_IT(&hi2c1_test, batch, 3);
+    if (status == I2C_OK) {
+        status = WaitIT(&hi2c1_test);
+    }
+    PrintTestResult("배치 전송 (3개 트랜잭션)", status);
+}
+
+/**
+ * @brief I2C 슬레이브 레지스터 맵 테스트
+ */
+static void Test_I2C_Slave_Functions(I2C_TypeDef* I2Cx) {
+    printf("\n=== 슬레이브 레지스터 맵 테스트 ===\n");
+    
+    static uint8_t regs[32];
+    static uint8_t status_regs[4] = {0xDE, 0xAD, 0xBE, 0xEF};
+    I2C_RegMap map = {.pData = regs, .Size = sizeof(regs), .PointerSize = I2C_MEMADD_SIZE_8BIT, .ReadOnly = 0};
+    I2C_RegMap status_map = {.pData = status_regs, .Size = sizeof(status_regs), .PointerSize = I2C_MEMADD_SIZE_8BIT, .ReadOnly = 1};
+    
+    hi2c1_test.Instance = I2Cx;
+    hi2c1_test.Config.OwnAddress = 0x42;
+    hi2c1_test.Config.OwnAddress2 = 0x43;
+    I2C_InitHandle(&hi2c1_test);
+    
+    I2C_Status status = I2C_Slave_StartRegMap_IT(&hi2c1_test, &map, &status_map);
+    PrintTestResult("슬레이브 레지스터 맵 시작 (0x42, 0x43)", status);
+    
+    status = I2C_Slave_StartRegMap_IT(&hi2c1_test, &map, NULL);
+    PrintTestResult("슬레이브 모드 중복 시작 (BUSY 예상)", status);
+    
+    I2C_Slave_Stop(&hi2c1_test);
+    hi2c1_test.Config.OwnAddress2 = 0;
+}
+
+static I2C_Handle hi2c2_test;
+static volatile uint8_t round_done;
+
+#define I2C2_EV_IRQ_NUMBER      33
+#define I2C2_ER_IRQ_NUMBER      34
+
+/**
+ * @brief I2C2 이벤트/에러 인터럽트 벡터
+ */
+void I2C2_EV_IRQHandler(void) {
+    I2C_EV_IRQHandler(&hi2c2_test);
+}
+
+void I2C2_ER_IRQHandler(void) {
+    I2C_ER_IRQHandler(&hi2c2_test);
+}
+
+/**
+ * @brief 듀얼 버스 라운드 완료 콜백
+ */
+static void DualBus_RoundComplete(I2C_DualBus* sched) {
+    (void)sched;
+    round_done = 1;
+}
+
+/**
+ * @brief I2C1/I2C2 듀얼 버스 병렬 읽기 테스트
+ */
+static void Test_I2C_DualBus_Functions(void) {
+    printf("\n=== 듀얼 버스 병렬 읽기 테스트 ===\n");
+    
+    static I2C_Transaction list1[4], list2[4];
+    static I2C_DualBus sched;
+    uint8_t reg_accel = 0x28, reg_gyro = 0x22, reg_temp = 0x00, reg_press = 0xF7;
+    uint8_t accel[6], gyro[6], temp[2], press[3];
+    
+    // I2C2 GPIO 설정 (PB10=SCL, PB3=SDA, AF9)
+    GPIO_Config gpio_config = {
+        .Mode = GPIO_MODE_ALT,
+        .Otype = GPIO_OTYPE_OPENDRAIN,
+        .Speed = GPIO_SPEED_HIGH,
+        .PuPd = GPIO_PUPD_PULLUP,
+        .AF = GPIO_AF4
+    };
+    gpio_config.Pin = (1 << 10);
+    GPIO_Init(GPIOB, &gpio_config);
+    gpio_config.AF = GPIO_AF9;
+    gpio_config.Pin = 3;  // PB3 (15 이하는 핀 번호로 해석되므로 마스크 대신 번호 사용)
+    GPIO_Init(GPIOB, &gpio_config);
+    
+    hi2c1_test.Instance = I2C1;
+    hi2c1_test.Config = (I2C_Config){.ClockSpeed = 400000, .OwnAddress = 0x42};
+    I2C_InitHandle(&hi2c1_test);
+    hi2c2_test.Instance = I2C2;
+    hi2c2_test.Config = (I2C_Config){.ClockSpeed = 400000, .OwnAddress = 0x42};
+    I2C_InitHandle(&hi2c2_test);
+    EnableIRQ(I2C1_EV_IRQ_NUMBER);
+    EnableIRQ(I2C1_ER_IRQ_NUMBER);
+    EnableIRQ(I2C2_EV_IRQ_NUMBER);
+    EnableIRQ(I2C2_ER_IRQ_NUMBER);
+    
+    sched.pBus[I2C_DUALBUS_0] = &hi2c1_test;
+    sched.pBus[I2C_DUALBUS_1] = &hi2c2_test;
+    sched.pList[I2C_DUALBUS_0] = list1;
+    sched.pList[I2C_DUALBUS_1] = list2;
+    sched.Capacity[I2C_DUALBUS_0] = 4;
+    sched.Capacity[I2C_DUALBUS_1] = 4;
+    sched.RoundCpltCallback = DualBus_RoundComplete;
+    I2C_DualBus_Init(&sched);
+    
+    // 장치별 버스 배정 (가속도/온도: I2C1, 자이로/기압: I2C2)
+    I2C_DualBus_Add(&sched, I2C_DUALBUS_0, &(I2C_Transaction){.DevAddress = 0x19, .pTxBuffer = &reg_accel, .TxSize = 1, .pRxBuffer = accel, .RxSize = 6});
+    I2C_DualBus_Add(&sched, I2C_DUALBUS_0, &(I2C_Transaction){.DevAddress = 0x48, .pTxBuffer = &reg_temp, .TxSize = 1, .pRxBuffer = temp, .RxSize = 2});
+    I2C_DualBus_Add(&sched, I2C_DUALBUS_1, &(I2C_Transaction){.DevAddress = 0x6B, .pTxBuffer = &reg_gyro, .TxSize = 1, .pRxBuffer = gyro, .RxSize = 6});
+    I2C_DualBus_Add(&sched, I2C_DUALBUS_1, &(I2C_Transaction){.DevAddress = 0x76, .pTxBuffer = &reg_press, .TxSize = 1, .pRxBuffer = press, .RxSize = 3});
+    
+    // 두 번의 샘플 라운드
+    for (int round = 0; round < 2; round++) {
+        round_done = 0;
+        I2C_Status status = I2C_DualBus_StartRound(&sched);
+        if (status == I2C_OK) {
+            uint32_t wait = 10000000;
+            while (!round_done && --wait);
+            status = round_done ? sched.Status : I2C_TIMEOUT;
+        }
+        PrintTestResult("듀얼 버스 라운드", status);
+    }
+    
+    I2C_DeInit(I2C2);
+}
+
+/**
+ * @brief SMBus 블록 전송 및 하드웨어 PEC 테스트
+ */
+static void Test_I2C_SMBus_Functions(I2C_TypeDef* I2Cx) {
+    printf("\n=== SMBus 블록 전송 (PEC) 테스트 ===\n");
+    
+    uint8_t battery_addr = 0x0B;  // 스마트 배터리 주소
+    uint8_t block[32];
+    uint8_t len = sizeof(block);
+    I2C_Config config = {
+        .ClockSpeed = 100000,
+        .OwnAddress = 0x42,
+        .SMBusMode = 1,
+        .PECEnable = 1
+    };
+    I2C_Init(I2Cx, &config);
+    
+    // ManufacturerName (0x20) 블록 읽기
+    I2C_Status status = I2C_SMBus_BlockRead(I2Cx, battery_addr, 0x20, block, &len);
+    PrintTestResult("SMBus 블록 읽기", status);
+    if (status == I2C_OK) {
+        printf("수신 길이: %d\n", len);
+    } else if (status == I2C_PEC_ERROR) {
+        printf("PEC 불일치 감지\n");
+    }
+    
+    // ManufacturerAccess (0x00) 블록 쓰기
+    uint8_t cmd[] = {0x01, 0x00};
+    status = I2C_SMBus_BlockWrite(I2Cx, battery_addr, 0x00, cmd, sizeof(cmd));
+    PrintTestResult("SMBus 블록 쓰기", status);
+    
+    // I2C 모드로 복원
+    config.SMBusMode = 0;
+    config.PECEnable = 0;
+    I2C_Init(I2Cx, &config);
+}
+
+/**
+ * @brief 멀티 마스터 중재 손실 재시도 테스트
+ */
+static void Test_I2C_Arbitration_Functions(I2C_TypeDef* I2Cx) {
+    printf("\n=== 중재 손실 재시도 테스트 ===\n");
+    
+    uint8_t reg = 0x00;
+    uint8_t value[2];
+    I2C_Stats stats;
+    
+    // 인스턴스 기본 정책: 5회, 50-1000us
+    I2C_RetryPolicy policy = {.MaxRetries = 5, .MinBackoffUs = 50, .MaxBackoffUs = 1000};
+    I2C_SetRetryPolicy(I2Cx, &policy);
+    I2C_ResetStats(I2Cx);
+    
+    I2C_Status status = I2C_WriteReadData(I2Cx, 0x50, &reg, 1, value, 2);
+    PrintTestResult("기본 정책 쓰기 후 읽기", status);
+    
+    // 트랜잭션별 정책: 재시도 없음
+    I2C_RetryPolicy no_retry = {.MaxRetries = 0};
+    I2C_Transaction xfer = {.DevAddress = 0x50, .pTxBuffer = &reg, .TxSize = 1, .pRxBuffer = value, .RxSize = 2, .pRetry = &no_retry};
+    status = I2C_Transfer(I2Cx, &xfer);
+    PrintTestResult("재시도 없는 트랜잭션", status);
+    if (status == I2C_ARBITRATION_LOST) {
+        printf("중재 손실 감지\n");
+    }
+    
+    I2C_GetStats(I2Cx, &stats);
+    printf("중재 손실: %lu, 재시도: %lu, 재시도 소진: %lu\n",
+           (unsigned long)stats.ArbitrationLost, (unsigned long)stats.Retries, (unsigned long)stats.RetryExhausted);
+}
+
+/**
+ * @brief 버스 주소 스캔 테스트
+ */
+static void Test_I2C_Scan_Functions(I2C_TypeDef* I2Cx) {
+    printf("\n=== 버스 주소 스캔 테스트 ===\n");
+    
+    uint8_t bitmap[16];
+    
+    // 전체 주소 스캔
+    I2C_Status status = I2C_Scan(I2Cx, NULL, 0, bitmap);
+    PrintTestResult("전체 주소 스캔", status);
+    printf("응답한 주소:");
+    for (uint8_t addr = I2C_SCAN_FIRST_ADDRESS; addr <= I2C_SCAN_LAST_ADDRESS; addr++) {
+        if (I2C_SCAN_IS_PRESENT(bitmap, addr)) {
+            printf(" 0x%02X", addr);
+        }
+    }
+    printf("\n");
+    
+    // 후보 주소만 스캔 (선택 장착 센서)
+    const uint8_t candidates[] = {0x19, 0x48, 0x50, 0x6B, 0x76};
+    status = I2C_Scan(I2Cx, candidates, sizeof(candidates), bitmap);
+    PrintTestResult("후보 주소 스캔", status);
+    printf("EEPROM(0x50): %s\n", I2C_SCAN_IS_PRESENT(bitmap, 0x50) ? "있음" : "없음");
 }
 
 /**
@@ -120,6 +529,20 @@ static void Test_I2C_Error_Functions(I2C_TypeDef* I2Cx) {
         }
         I2C_Stop(I2Cx);
     }
+    
+    // 버스 복구 테스트 (PB6=SCL, PB7=SDA)
+    printf("\n버스 복구 테스트...\n");
+    I2C_SetRecoveryPins(I2Cx, GPIOB, 6, 7, GPIO_AF4);
+    status = I2C_RecoverBus(I2Cx);
+    PrintTestResult("버스 복구", status);
+    
+    // 자동 복구는 명시적으로 켠 경우에만 동작 (멀티 마스터 버스 보호)
+    I2C_SetAutoRecovery(I2Cx, 1);
+    
+    // 복구 후 정상 통신 확인
+    status = I2C_Start(I2Cx);
+    PrintTestResult("복구 후 시작 조건", status);
+    I2C_Stop(I2Cx);
 }
 
 void I2C_Test(void) {
@@ -157,6 +580,13 @@ void I2C_Test(void) {
     // 테스트 실행
     Test_I2C_Speed_Functions(I2C1);
     Test_I2C_Data_Functions(I2C1);
+    Test_I2C_DMA_Functions(I2C1);
+    Test_I2C_IT_Functions(I2C1);
+    Test_I2C_Slave_Functions(I2C1);
+    Test_I2C_DualBus_Functions();
+    Test_I2C_SMBus_Functions(I2C1);
+    Test_I2C_Arbitration_Functions(I2C1);
+    Test_I2C_Scan_Functions(I2C1);
     Test_I2C_Error_Functions(I2C1);
     
     // 정리
@@ -5,8 +5,13 @@
 extern void GPIO_Test(void);
 extern void RCC_Test(void);
 extern void I2C_Test(void);
+extern void I2C_Cache_Test(void);
+extern void EEPROM_Test(void);
+extern void I2C_Mux_Test(void);
 extern void USART_Test(void);
 extern void SPI_Test(void);
+extern void SPI_Bus_Test(void);
+extern void SPI_Flash_Test(void);
 
 /**
  * @brief 메인 테스트 함수
@@ -28,9 +33,24 @@ int main(void)
     // I2C 테스트
     I2C_Test();
     
+    // I2C 레지스터 캐시 테스트
+    I2C_Cache_Test();
+    
+    // EEPROM 테스트
+    EEPROM_Test();
+    
+    // I2C 멀티플렉서 테스트
+    I2C_Mux_Test();
+    
     // SPI 테스트
     SPI_Test();
     
+    // SPI 멀티 장치 버스 테스트
+    SPI_Bus_Test();
+    
+    // SPI NOR 플래시 테스트
+    SPI_Flash_Test();
+    
     // USART 테스트
     USART_Test();
     
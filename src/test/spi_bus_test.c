@@ -0,0 +1,115 @@
+#include "../spi_bus.h"
+#include <stdio.h>
+
+/**
+ * @brief 테스트 결과를 출력하는 헬퍼 함수
+ */
+static void PrintTestResult(const char* test_name, SPI_Status status) {
+    if (status == SPI_OK) {
+        printf("%s: 성공\n", test_name);
+    } else {
+        printf("%s: 실패 (상태: %d)\n", test_name, status);
+    }
+}
+
+static SPI_Bus bus = {
+    .Instance = SPI1
+};
+
+// 플래시 (모드 0, 8MHz 요청), 디스플레이 (모드 3, 16비트), ADC (모드 1, 1MHz)
+static SPI_Device flash = {
+    .Config = {.ClockSpeed = 8000000, .Mode = SPI_MODE_0, .DataSize = 0, .FirstBit = 0, .NSS = 1},
+    .CSPort = GPIOA,
+    .CSPin = 4
+};
+static SPI_Device display = {
+    .Config = {.ClockSpeed = 4000000, .Mode = SPI_MODE_3, .DataSize = 1, .FirstBit = 0, .NSS = 1},
+    .CSPort = GPIOB,
+    .CSPin = 0  // PB0 (PB6/PB7은 I2C1 SCL/SDA)
+};
+static SPI_Device adc = {
+    .Config = {.ClockSpeed = 1000000, .Mode = SPI_MODE_1, .DataSize = 0, .FirstBit = 0, .NSS = 1},
+    .CSPort = GPIOB,
+    .CSPin = 1  // PB1
+};
+
+/**
+ * @brief 장치 등록 및 전환 테스트
+ */
+static void Test_SPI_Bus_Functions(void) {
+    printf("\n=== SPI 멀티 장치 버스 테스트 ===\n");
+
+    SPI_Status status;
+
+    SPI_Bus_Init(&bus);
+    SPI_Bus_AddDevice(&bus, &flash);
+    SPI_Bus_AddDevice(&bus, &display);
+    SPI_Bus_AddDevice(&bus, &adc);
+
+    printf("플래시 CR1: 0x%04lX, 디스플레이 CR1: 0x%04lX, ADC CR1: 0x%04lX\n",
+           (unsigned long)flash.CR1, (unsigned long)display.CR1, (unsigned long)adc.CR1);
+
+    // 칩 셀렉트는 모두 비활성(High)이어야 함
+    printf("CS 초기 상태: %s\n",
+           (GPIOA->IDR & (1 << 4)) && (GPIOB->IDR & (1 << 6)) && (GPIOB->IDR & (1 << 7)) ? "모두 High (성공)" : "실패");
+
+    status = SPI_Bus_Select(&bus, &flash);
+    PrintTestResult("플래시 선택 (최초 초기화)", status);
+
+    status = SPI_Bus_Select(&bus, &flash);
+    PrintTestResult("플래시 재선택 (캐시)", status);
+
+    status = SPI_Bus_Select(&bus, &adc);
+    PrintTestResult("ADC 전환", status);
+    printf("ADC 전환 후 CR1: %s\n", SPI1->CR1.w == adc.CR1 ? "일치 (성공)" : "불일치 (실패)");
+
+    // DFF가 다른 장치로 전환
+    status = SPI_Bus_Select(&bus, &display);
+    PrintTestResult("디스플레이 전환 (16비트)", status);
+    printf("디스플레이 전환 후 CR1: %s\n", SPI1->CR1.w == display.CR1 ? "일치 (성공)" : "불일치 (실패)");
+}
+
+/**
+ * @brief 칩 셀렉트 구간 전송 테스트
+ */
+static void Test_SPI_Bus_Transfer_Functions(void) {
+    printf("\n=== SPI 버스 전송 테스트 ===\n");
+
+    uint8_t jedec_cmd = 0x9F;
+    uint8_t jedec_id[3];
+    uint8_t adc_tx[2] = {0x80, 0x00};
+    uint8_t adc_rx[2];
+    SPI_Status status;
+
+    status = SPI_Bus_WriteRead(&bus, &flash, &jedec_cmd, 1, jedec_id, 3);
+    PrintTestResult("플래시 JEDEC ID 읽기", status);
+    if (status == SPI_OK) {
+        printf("JEDEC ID: %02X %02X %02X\n", jedec_id[0], jedec_id[1], jedec_id[2]);
+    }
+
+    status = SPI_Bus_Transfer(&bus, &adc, adc_tx, adc_rx, 2);
+    PrintTestResult("ADC 변환 읽기", status);
+
+    // 전송 후 칩 셀렉트 해제 확인
+    printf("전송 후 CS: %s\n", (GPIOB->IDR & (1 << 7)) ? "High (성공)" : "Low (실패)");
+
+    // 여러 전송을 하나의 칩 셀렉트 구간으로 묶기
+    status = SPI_Bus_Begin(&bus, &flash);
+    if (status == SPI_OK) {
+        status = SPI_WriteData(bus.Instance, &jedec_cmd, 1);
+        if (status == SPI_OK) {
+            status = SPI_ReadData(bus.Instance, jedec_id, 3);
+        }
+        SPI_Bus_End(&bus);
+    }
+    PrintTestResult("Begin/End 구간 전송", status);
+}
+
+void SPI_Bus_Test(void) {
+    printf("===== SPI 멀티 장치 버스 테스트 시작 =====\n");
+
+    Test_SPI_Bus_Functions();
+    Test_SPI_Bus_Transfer_Functions();
+
+    printf("\n===== SPI 멀티 장치 버스 테스트 완료 =====\n");
+}
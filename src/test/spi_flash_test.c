@@ -0,0 +1,168 @@
+#include "../spi_flash.h"
+#include <stdio.h>
+
+/**
+ * @brief 테스트 결과를 출력하는 헬퍼 함수
+ */
+static void PrintTestResult(const char* test_name, SPI_Status status) {
+    if (status == SPI_OK) {
+        printf("%s: 성공\n", test_name);
+    } else {
+        printf("%s: 실패 (상태: %d)\n", test_name, status);
+    }
+}
+
+static SPI_Bus flash_bus = {
+    .Instance = SPI1
+};
+
+static SPI_Device flash_dev = {
+    .Config = {.ClockSpeed = 8000000, .Mode = SPI_MODE_0, .DataSize = 0, .FirstBit = 0, .NSS = 1},
+    .CSPort = GPIOA,
+    .CSPin = 4
+};
+
+// W25Q16 (2MB)
+static SPI_Flash flash = {
+    .pBus = &flash_bus,
+    .pDevice = &flash_dev,
+    .Capacity = 2 * 1024 * 1024
+};
+
+/**
+ * @brief 지우기/쓰기/읽기 테스트
+ */
+static void Test_SPI_Flash_Functions(void) {
+    printf("\n=== SPI NOR 플래시 테스트 ===\n");
+
+    static uint8_t tx_data[600];
+    static uint8_t rx_data[600];
+    uint8_t id[3];
+    SPI_Status status;
+
+    for (int i = 0; i < 600; i++) {
+        tx_data[i] = (uint8_t)(i * 3);
+    }
+
+    status = SPI_Flash_ReadID(&flash, id);
+    PrintTestResult("JEDEC ID 읽기", status);
+    if (status == SPI_OK) {
+        printf("JEDEC ID: %02X %02X %02X\n", id[0], id[1], id[2]);
+    }
+
+    status = SPI_Flash_EraseSector(&flash, 0x001000);
+    PrintTestResult("섹터 지우기 (0x001000)", status);
+
+    // 페이지 중간에서 시작하여 페이지 경계 3개에 걸친 쓰기
+    status = SPI_Flash_Write(&flash, 0x001080, tx_data, sizeof(tx_data));
+    PrintTestResult("페이지 분할 쓰기 (600바이트)", status);
+
+    status = SPI_Flash_Read(&flash, 0x001080, rx_data, sizeof(rx_data));
+    PrintTestResult("고속 읽기", status);
+    if (status == SPI_OK) {
+        int errors = 0;
+        for (int i = 0; i < 600; i++) {
+            if (rx_data[i] != tx_data[i]) {
+                errors++;
+            }
+        }
+        printf("데이터 비교: %s (불일치 %d바이트)\n", errors == 0 ? "성공" : "실패", errors);
+    }
+
+    // 범위 밖 접근
+    status = SPI_Flash_Read(&flash, flash.Capacity - 1, rx_data, 2);
+    printf("범위 밖 읽기: %s\n", status == SPI_ERROR ? "거부됨 (성공)" : "실패");
+}
+
+/* NVIC 인터럽트 번호 (RM0383 벡터 테이블) - 벡터는 spi_test.c에서 SPI_DMA_IRQHandler(SPI1)로 연결 */
+#define DMA2_STREAM0_IRQ_NUMBER 56
+#define DMA2_STREAM3_IRQ_NUMBER 59
+
+/**
+ * @brief NVIC 인터럽트를 활성화하는 헬퍼 함수 (ISER 직접 쓰기)
+ */
+static void EnableIRQ(uint8_t irqn) {
+    volatile uint32_t* iser = (volatile uint32_t*)0xE000E100UL;
+    iser[irqn >> 5] = 1UL << (irqn & 0x1F);
+}
+
+static volatile uint32_t stream_blocks;
+static volatile uint32_t stream_bytes;
+static volatile uint32_t stream_sum;
+static volatile SPI_Status stream_status;
+
+/**
+ * @brief 연속 읽기 블록 콜백 - DMA가 다른 절반을 채우는 동안 블록 처리
+ */
+static void Stream_Block(SPI_Flash* f, uint8_t* data, uint16_t len, SPI_Status status) {
+    (void)f;
+    stream_status = status;
+    if (status != SPI_OK) {
+        return;
+    }
+    for (uint16_t i = 0; i < len; i++) {
+        stream_sum += data[i];
+    }
+    stream_bytes += len;
+    stream_blocks++;
+}
+
+/**
+ * @brief 핑퐁 버퍼 연속 읽기 테스트
+ */
+static void Test_SPI_Flash_Stream_Functions(void) {
+    printf("\n=== SPI 플래시 연속 읽기 테스트 ===\n");
+
+    static uint8_t ping_pong[1024];
+    SPI_Status status;
+
+    EnableIRQ(DMA2_STREAM0_IRQ_NUMBER);
+    EnableIRQ(DMA2_STREAM3_IRQ_NUMBER);
+
+    // 512바이트 블록 16개 (8KB)
+    stream_blocks = 0;
+    stream_bytes = 0;
+    stream_sum = 0;
+    stream_status = SPI_OK;
+    status = SPI_Flash_StartStream(&flash, 0x000000, ping_pong, sizeof(ping_pong), 16, Stream_Block);
+    PrintTestResult("연속 읽기 시작", status);
+    if (status == SPI_OK) {
+        // 진행 중 다른 연속 읽기는 거부
+        printf("진행 중 재요청: %s\n",
+               SPI_Flash_StartStream(&flash, 0, ping_pong, sizeof(ping_pong), 1, Stream_Block) == SPI_BUSY ? "거부됨" : "실패");
+        uint32_t wait = 10000000;
+        while (flash.Streaming && --wait);
+        if (flash.Streaming) {
+            SPI_Flash_StopStream(&flash);
+            stream_status = SPI_TIMEOUT;
+        }
+        PrintTestResult("연속 읽기 완료", stream_status);
+        printf("수신 블록: %lu, 수신 바이트: %lu, 합계: 0x%08lX\n",
+               (unsigned long)stream_blocks, (unsigned long)stream_bytes, (unsigned long)stream_sum);
+    }
+
+    // 블록 수 제한 없이 시작 후 수동 중단
+    stream_blocks = 0;
+    status = SPI_Flash_StartStream(&flash, 0x000000, ping_pong, sizeof(ping_pong), 0, Stream_Block);
+    if (status == SPI_OK) {
+        uint32_t wait = 10000000;
+        while (stream_blocks < 20 && --wait);
+        SPI_Flash_StopStream(&flash);
+        if (stream_blocks < 20) {
+            status = SPI_TIMEOUT;
+        }
+    }
+    PrintTestResult("연속 읽기 수동 중단", status);
+}
+
+void SPI_Flash_Test(void) {
+    printf("===== SPI NOR 플래시 테스트 시작 =====\n");
+
+    SPI_Bus_Init(&flash_bus);
+    SPI_Bus_AddDevice(&flash_bus, &flash_dev);
+
+    Test_SPI_Flash_Functions();
+    Test_SPI_Flash_Stream_Functions();
+
+    printf("\n===== SPI NOR 플래시 테스트 완료 =====\n");
+}
@@ -1,5 +1,6 @@
 #include "../spi.h"
 #include "../gpio.h"
+#include "../rcc.h"
 #include <stdio.h>
 
 /**
@@ -104,6 +105,574 @@ static void Test_SPI_Data_Functions(SPI_TypeDef* SPIx) {
     TestSPITransfer(SPIx, "LSB 우선", 0x5AA5);
 }
 
+/**
+ * @brief SPI 연속 쓰기 테스트
+ */
+static void Test_SPI_Stream_Functions(SPI_TypeDef* SPIx) {
+    printf("\n=== SPI 연속 쓰기 테스트 ===\n");
+    
+    static uint8_t tx_data[512];
+    SPI_Status status;
+    
+    for (int i = 0; i < 512; i++) {
+        tx_data[i] = (uint8_t)(i ^ 0x5A);
+    }
+    
+    // TXE 기반 연속 쓰기 (프레임 사이 공백 없음)
+    status = SPI_WriteData(SPIx, tx_data, sizeof(tx_data));
+    PrintTestResult("연속 쓰기", status);
+    
+    // 쓰기 후 OVR이 남아 있지 않아야 함
+    printf("쓰기 후 OVR: %s\n", SPIx->SR.b.OVR ? "설정됨 (실패)" : "없음 (성공)");
+    
+    // 이어지는 송수신이 이전 쓰기의 수신 데이터에 영향받지 않아야 함
+    uint8_t tx = 0xA5, rx = 0;
+    status = SPI_TransferData(SPIx, &tx, &rx, 1);
+    PrintTestResult("연속 쓰기 후 송수신", status);
+}
+
+static volatile uint8_t dma_done;
+static volatile SPI_Status dma_status;
+
+/**
+ * @brief SPI DMA 전송 완료 콜백
+ */
+static void DMA_Complete(SPI_TypeDef* SPIx, SPI_Status status) {
+    (void)SPIx;
+    dma_status = status;
+    dma_done = 1;
+}
+
+/**
+ * @brief DMA 전송 완료를 제한 시간 동안 기다리는 헬퍼 함수
+ */
+static SPI_Status WaitDMA(void) {
+    uint32_t wait = 10000000;
+    while (!dma_done && --wait);
+    return dma_done ? dma_status : SPI_TIMEOUT;
+}
+
+/* NVIC 인터럽트 번호 (RM0383 벡터 테이블) */
+#define DMA2_STREAM0_IRQ_NUMBER 56
+#define DMA2_STREAM3_IRQ_NUMBER 59
+
+/**
+ * @brief NVIC 인터럽트를 활성화하는 헬퍼 함수 (ISER 직접 쓰기)
+ */
+static void EnableIRQ(uint8_t irqn) {
+    volatile uint32_t* iser = (volatile uint32_t*)0xE000E100UL;
+    iser[irqn >> 5] = 1UL << (irqn & 0x1F);
+}
+
+/**
+ * @brief SPI1 DMA 스트림 인터럽트 벡터 (DMA2 Stream 0: RX, Stream 3: TX)
+ */
+void DMA2_Stream0_IRQHandler(void) {
+    SPI_DMA_IRQHandler(SPI1);
+}
+
+void DMA2_Stream3_IRQHandler(void) {
+    SPI_DMA_IRQHandler(SPI1);
+}
+
+/**
+ * @brief SPI DMA 송수신 테스트
+ */
+static void Test_SPI_DMA_Functions(SPI_TypeDef* SPIx) {
+    printf("\n=== SPI DMA 전송 테스트 ===\n");
+    
+    static uint8_t tx_data[256];
+    static uint8_t rx_data[256];
+    SPI_Status status;
+    
+    // 이후 16비트/CRC/방향/채우기 DMA 테스트도 같은 스트림 인터럽트 사용
+    EnableIRQ(DMA2_STREAM0_IRQ_NUMBER);
+    EnableIRQ(DMA2_STREAM3_IRQ_NUMBER);
+    
+    for (int i = 0; i < 256; i++) {
+        tx_data[i] = (uint8_t)i;
+    }
+    
+    // 송수신 (MOSI-MISO 루프백 시 rx_data == tx_data)
+    dma_done = 0;
+    status = SPI_TransferData_DMA(SPIx, tx_data, rx_data, sizeof(tx_data), DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("DMA 송수신", status);
+    
+    // 송신 전용
+    dma_done = 0;
+    status = SPI_WriteData_DMA(SPIx, tx_data, sizeof(tx_data), DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("DMA 송신 전용", status);
+    
+    // 수신 전용 (더미 0xFF 송신)
+    dma_done = 0;
+    status = SPI_ReadData_DMA(SPIx, rx_data, sizeof(rx_data), DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("DMA 수신 전용", status);
+    
+    // 전송 중 재요청
+    dma_done = 0;
+    status = SPI_WriteData_DMA(SPIx, tx_data, sizeof(tx_data), DMA_Complete);
+    if (status == SPI_OK) {
+        printf("전송 중 재요청: %s\n", SPI_WriteData_DMA(SPIx, tx_data, 1, NULL) == SPI_BUSY ? "거부됨" : "실패");
+        PrintTestResult("전송 중 재요청 후 완료", WaitDMA());
+    }
+}
+
+/**
+ * @brief SPI 16비트 프레임 테스트
+ */
+static void Test_SPI_16Bit_Functions(SPI_TypeDef* SPIx) {
+    printf("\n=== SPI 16비트 프레임 테스트 ===\n");
+    
+    static uint16_t tx_data[128];
+    static uint16_t rx_data[128];
+    SPI_Status status;
+    
+    for (int i = 0; i < 128; i++) {
+        tx_data[i] = (uint16_t)(0xA500 | i);
+    }
+    
+    // 8비트 설정에서는 거부되어야 함
+    SPIx->CR1.b.SPE = 0;
+    SPIx->CR1.b.DFF = 0;
+    SPIx->CR1.b.SPE = 1;
+    status = SPI_WriteData16(SPIx, tx_data, 1);
+    printf("8비트 설정에서 16비트 쓰기: %s\n", status == SPI_ERROR ? "거부됨 (성공)" : "실패");
+    
+    // 16비트 프레임 설정 (DFF는 SPE=0 상태에서 변경)
+    SPIx->CR1.b.SPE = 0;
+    SPIx->CR1.b.DFF = 1;
+    SPIx->CR1.b.SPE = 1;
+    
+    status = SPI_WriteData16(SPIx, tx_data, 128);
+    PrintTestResult("16비트 연속 쓰기", status);
+    
+    // MOSI-MISO 루프백 시 rx_data == tx_data
+    status = SPI_TransferData16(SPIx, tx_data, rx_data, 128);
+    PrintTestResult("16비트 송수신", status);
+    if (status == SPI_OK) {
+        printf("첫 프레임 송신: 0x%04X, 수신: 0x%04X\n", tx_data[0], rx_data[0]);
+    }
+    
+    status = SPI_ReadData16(SPIx, rx_data, 128);
+    PrintTestResult("16비트 읽기", status);
+    
+    dma_done = 0;
+    status = SPI_TransferData16_DMA(SPIx, tx_data, rx_data, 128, DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("16비트 DMA 송수신", status);
+    
+    dma_done = 0;
+    status = SPI_WriteData16_DMA(SPIx, tx_data, 128, DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("16비트 DMA 송신 전용", status);
+    
+    dma_done = 0;
+    status = SPI_ReadData16_DMA(SPIx, rx_data, 128, DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("16비트 DMA 수신 전용", status);
+    
+    // 8비트 프레임으로 복원
+    SPIx->CR1.b.SPE = 0;
+    SPIx->CR1.b.DFF = 0;
+    SPIx->CR1.b.SPE = 1;
+}
+
+static SPI_Handle hspi1_test;
+static volatile uint8_t it_done;
+
+#define SPI1_IRQ_NUMBER         35
+
+/**
+ * @brief SPI1 인터럽트 벡터
+ */
+void SPI1_IRQHandler(void) {
+    SPI_IRQHandler(&hspi1_test);
+}
+
+/**
+ * @brief SPI 인터럽트 전송 완료/오류 콜백
+ */
+static void IT_Complete(SPI_Handle* hspi) {
+    (void)hspi;
+    it_done = 1;
+}
+
+/**
+ * @brief 인터럽트 전송 완료를 제한 시간 동안 기다리는 헬퍼 함수
+ */
+static SPI_Status WaitIT(SPI_Handle* hspi) {
+    uint32_t wait = 10000000;
+    while (!it_done && --wait);
+    return it_done ? hspi->ErrorCode : SPI_TIMEOUT;
+}
+
+/**
+ * @brief SPI 인터럽트 기반 송수신 테스트
+ */
+static void Test_SPI_IT_Functions(SPI_TypeDef* SPIx) {
+    printf("\n=== SPI 인터럽트 전송 테스트 ===\n");
+    
+    uint8_t tx_data[16];
+    uint8_t rx_data[16];
+    SPI_Status status;
+    
+    for (int i = 0; i < 16; i++) {
+        tx_data[i] = (uint8_t)(0x30 + i);
+    }
+    
+    hspi1_test.Instance = SPIx;
+    hspi1_test.Config.ClockSpeed = 1000000;
+    hspi1_test.Config.Mode = SPI_MODE_0;
+    hspi1_test.Config.DataSize = 0;
+    hspi1_test.Config.FirstBit = 0;
+    hspi1_test.Config.NSS = 1;
+    hspi1_test.XferCpltCallback = IT_Complete;
+    hspi1_test.ErrorCallback = IT_Complete;
+    SPI_InitHandle(&hspi1_test);
+    EnableIRQ(SPI1_IRQ_NUMBER);
+    
+    // 송수신 (MOSI-MISO 루프백 시 rx_data == tx_data)
+    it_done = 0;
+    status = SPI_TransferData_IT(&hspi1_test, tx_data, rx_data, sizeof(tx_data));
+    if (status == SPI_OK) {
+        // 전송 중 재요청은 거부되어야 함
+        if (!it_done) {
+            printf("전송 중 재요청: %s\n", SPI_WriteData_IT(&hspi1_test, tx_data, 1) == SPI_BUSY ? "거부됨" : "실패");
+        }
+        status = WaitIT(&hspi1_test);
+    }
+    PrintTestResult("인터럽트 송수신", status);
+    
+    // 송신 전용
+    it_done = 0;
+    status = SPI_WriteData_IT(&hspi1_test, tx_data, sizeof(tx_data));
+    if (status == SPI_OK) {
+        status = WaitIT(&hspi1_test);
+    }
+    PrintTestResult("인터럽트 송신 전용", status);
+    
+    // 수신 전용
+    it_done = 0;
+    status = SPI_ReadData_IT(&hspi1_test, rx_data, sizeof(rx_data));
+    if (status == SPI_OK) {
+        status = WaitIT(&hspi1_test);
+    }
+    PrintTestResult("인터럽트 수신 전용", status);
+}
+
+/**
+ * @brief SPI 클럭 분주비 계산 테스트
+ */
+static void Test_SPI_Clock_Functions(SPI_TypeDef* SPIx) {
+    printf("\n=== SPI 클럭 분주비 테스트 ===\n");
+    
+    static const uint32_t speeds[] = {50000000, 10000000, 8000000, 3000000, 1000000, 100000};
+    uint32_t sck;
+    
+    SPI_Config config = {
+        .Mode = SPI_MODE_0,
+        .DataSize = 0,
+        .FirstBit = 0,
+        .NSS = 1
+    };
+    
+    // 요청 속도를 넘지 않는 가장 빠른 SCK가 선택되어야 함
+    for (unsigned i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++) {
+        config.ClockSpeed = speeds[i];
+        SPI_Init(SPIx, &config);
+        sck = SPI_GetClock(SPIx);
+        printf("요청: %lu Hz, 실제: %lu Hz (BR=%u) - %s\n",
+               (unsigned long)speeds[i], (unsigned long)sck, (unsigned)SPIx->CR1.b.BR,
+               (sck <= speeds[i] || SPIx->CR1.b.BR == 7) && (SPIx->CR1.b.BR == 0 || sck * 2 > speeds[i]) ? "성공" : "실패");
+    }
+    
+    // 버스 클럭 변경 후 재계산 (클럭이 같으면 분주비도 유지)
+    config.ClockSpeed = 1000000;
+    SPI_Init(SPIx, &config);
+    sck = SPI_UpdateClock(SPIx, &config);
+    printf("클럭 재계산: %lu Hz (PCLK %lu Hz) - %s\n", (unsigned long)sck,
+           (unsigned long)(SPIx == SPI1 ? RCC_GetPCLK2() : RCC_GetPCLK1()),
+           sck == SPI_GetClock(SPIx) && sck <= config.ClockSpeed ? "성공" : "실패");
+}
+
+/**
+ * @brief SPI 슬레이브 프레임 콜백
+ */
+static volatile uint16_t slave_frames;
+static volatile uint16_t slave_last_len;
+static volatile SPI_Status slave_status;
+
+static void Slave_Frame(SPI_TypeDef* SPIx, uint16_t offset, uint16_t len, SPI_Status status) {
+    (void)SPIx;
+    (void)offset;
+    slave_last_len = len;
+    slave_status = status;
+    slave_frames++;
+}
+
+/**
+ * @brief SPI 슬레이브 모드 테스트 (외부 마스터가 PA4=NSS로 프레임을 보내야 함)
+ */
+static void Test_SPI_Slave_Functions(SPI_TypeDef* SPIx) {
+    printf("\n=== SPI 슬레이브 모드 테스트 ===\n");
+    
+    static uint8_t ring[256];
+    static uint8_t response[16];
+    uint8_t ring_data;
+    SPI_Status status;
+    
+    for (int i = 0; i < 16; i++) {
+        response[i] = (uint8_t)(0xA0 + i);
+    }
+    
+    // 마스터 모드에서는 거부
+    status = SPI_Slave_Start_DMA(SPIx, ring, sizeof(ring), response, sizeof(response), Slave_Frame);
+    printf("마스터 모드에서 슬레이브 시작: %s\n", status == SPI_ERROR ? "거부됨 (성공)" : "실패");
+    
+    // 하드웨어 NSS 슬레이브 (PA4 = NSS 입력, AF5)
+    GPIO_Config nss_config = {
+        .Pin = 4,
+        .Mode = GPIO_MODE_ALT,
+        .Otype = GPIO_OTYPE_PUSHPULL,
+        .Speed = GPIO_SPEED_HIGH,
+        .PuPd = GPIO_PUPD_NONE,
+        .AF = GPIO_AF5
+    };
+    GPIO_Init(GPIOA, &nss_config);
+    
+    SPI_Config config = {
+        .Mode = SPI_MODE_0,
+        .DataSize = 0,
+        .FirstBit = 0,
+        .NSS = 0,
+        .Slave = 1
+    };
+    SPI_Init(SPIx, &config);
+    printf("슬레이브 설정: MSTR=%u, SSM=%u\n", (unsigned)SPIx->CR1.b.MSTR, (unsigned)SPIx->CR1.b.SSM);
+    
+    slave_frames = 0;
+    status = SPI_Slave_Start_DMA(SPIx, ring, sizeof(ring), response, sizeof(response), Slave_Frame);
+    PrintTestResult("슬레이브 DMA 시작", status);
+    
+    status = SPI_ReadData_DMA(SPIx, &ring_data, 1, DMA_Complete);
+    printf("슬레이브 동작 중 다른 DMA: %s\n", status == SPI_BUSY ? "거부됨 (성공)" : "실패");
+    
+    // EXTI 대신 NSS 핀 상승 에지를 폴링하여 프레임 종료 처리
+    uint8_t nss_prev = (GPIOA->IDR >> 4) & 1;
+    uint32_t wait = 10000000;
+    while (slave_frames < 4 && --wait) {
+        uint8_t nss = (GPIOA->IDR >> 4) & 1;
+        if (nss && !nss_prev) {
+            SPI_Slave_NSSHandler(SPIx);
+        }
+        nss_prev = nss;
+    }
+    if (slave_frames > 0) {
+        printf("수신 프레임: %u, 마지막 프레임 길이: %u\n", (unsigned)slave_frames, (unsigned)slave_last_len);
+        PrintTestResult("슬레이브 프레임 수신", slave_status);
+    } else {
+        printf("슬레이브 프레임 수신: 마스터 없음 (건너뜀)\n");
+    }
+    
+    SPI_Slave_Stop_DMA(SPIx);
+    
+    // 마스터 모드로 복귀
+    config.Slave = 0;
+    config.NSS = 1;
+    config.ClockSpeed = 1000000;
+    SPI_Init(SPIx, &config);
+}
+
+/**
+ * @brief SPI 수신 전용 및 반이중 3선 모드 테스트
+ */
+static void Test_SPI_Direction_Functions(SPI_TypeDef* SPIx) {
+    printf("\n=== SPI 수신 전용/반이중 모드 테스트 ===\n");
+    
+    uint8_t tx_data[4] = {0x9F, 0x00, 0x00, 0x00};
+    uint8_t rx_data[64];
+    uint16_t rx_data16[16];
+    SPI_Status status;
+    
+    SPI_Config config = {
+        .ClockSpeed = 1000000,
+        .Mode = SPI_MODE_0,
+        .DataSize = 0,
+        .FirstBit = 0,
+        .NSS = 1,
+        .Direction = SPI_DIRECTION_2LINES_RXONLY
+    };
+    
+    // 수신 전용: 읽기 전에는 클럭이 나가지 않도록 SPE=0
+    SPI_Init(SPIx, &config);
+    printf("수신 전용 대기 상태: SPE=%u (0이어야 함)\n", (unsigned)SPIx->CR1.b.SPE);
+    
+    status = SPI_ReadData(SPIx, rx_data, sizeof(rx_data));
+    PrintTestResult("수신 전용 폴링 읽기", status);
+    printf("읽기 후 클럭 정지: %s\n", SPIx->CR1.b.SPE == 0 ? "성공" : "실패");
+    
+    status = SPI_ReadData(SPIx, rx_data, 1);
+    PrintTestResult("수신 전용 1바이트 읽기", status);
+    
+    dma_done = 0;
+    status = SPI_ReadData_DMA(SPIx, rx_data, sizeof(rx_data), DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("수신 전용 DMA 읽기", status);
+    
+    status = SPI_WriteData(SPIx, tx_data, sizeof(tx_data));
+    printf("수신 전용 모드 쓰기: %s\n", status == SPI_ERROR ? "거부됨 (성공)" : "실패");
+    
+    // 16비트 수신 전용
+    config.DataSize = 1;
+    SPI_Init(SPIx, &config);
+    status = SPI_ReadData16(SPIx, rx_data16, 16);
+    PrintTestResult("수신 전용 16비트 읽기", status);
+    
+    // 반이중 3선: 명령 쓰기 후 같은 선으로 응답 읽기
+    config.DataSize = 0;
+    config.Direction = SPI_DIRECTION_1LINE;
+    SPI_Init(SPIx, &config);
+    printf("반이중 대기 상태: BIDIMODE=%u, BIDIOE=%u\n", (unsigned)SPIx->CR1.b.BIDIMODE, (unsigned)SPIx->CR1.b.BIDIOE);
+    
+    status = SPI_WriteData(SPIx, tx_data, 1);
+    PrintTestResult("반이중 쓰기", status);
+    status = SPI_ReadData(SPIx, rx_data, 3);
+    PrintTestResult("반이중 폴링 읽기", status);
+    printf("읽기 후 송신 방향 복귀: %s\n", SPIx->CR1.b.BIDIOE ? "성공" : "실패");
+    
+    dma_done = 0;
+    status = SPI_ReadData_DMA(SPIx, rx_data, sizeof(rx_data), DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("반이중 DMA 읽기", status);
+    
+    status = SPI_TransferData(SPIx, tx_data, rx_data, sizeof(tx_data));
+    printf("반이중 모드 동시 송수신: %s\n", status == SPI_ERROR ? "거부됨 (성공)" : "실패");
+    
+    // 전이중 모드로 복귀
+    config.Direction = SPI_DIRECTION_2LINES;
+    SPI_Init(SPIx, &config);
+}
+
+/**
+ * @brief SPI 상수 채우기 DMA 테스트
+ */
+static void Test_SPI_Fill_Functions(SPI_TypeDef* SPIx) {
+    printf("\n=== SPI 채우기 DMA 테스트 ===\n");
+    
+    SPI_Status status;
+    
+    SPI_Config config = {
+        .ClockSpeed = 8000000,
+        .Mode = SPI_MODE_0,
+        .DataSize = 0,
+        .FirstBit = 0,
+        .NSS = 1
+    };
+    SPI_Init(SPIx, &config);
+    
+    // 8비트 패딩 (한 구간)
+    dma_done = 0;
+    status = SPI_Fill_DMA(SPIx, 0xFF, 512, DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("8비트 채우기 (512바이트)", status);
+    
+    // 320x240 LCD 지우기: 16비트 76800 프레임 (65535 초과 - 자동 재설정)
+    config.DataSize = 1;
+    SPI_Init(SPIx, &config);
+    dma_done = 0;
+    status = SPI_Fill_DMA(SPIx, 0xF800, 320UL * 240UL, DMA_Complete);
+    if (status == SPI_OK) {
+        printf("진행 중 다른 DMA: %s\n", SPI_Fill_DMA(SPIx, 0, 1, NULL) == SPI_BUSY ? "거부됨 (성공)" : "실패");
+        status = WaitDMA();
+    }
+    PrintTestResult("16비트 채우기 (320x240)", status);
+    
+    // 수신 전용 모드에서는 거부
+    config.DataSize = 0;
+    config.Direction = SPI_DIRECTION_2LINES_RXONLY;
+    SPI_Init(SPIx, &config);
+    status = SPI_Fill_DMA(SPIx, 0x00, 16, NULL);
+    printf("수신 전용 모드 채우기: %s\n", status == SPI_ERROR ? "거부됨 (성공)" : "실패");
+    
+    config.Direction = SPI_DIRECTION_2LINES;
+    SPI_Init(SPIx, &config);
+}
+
+/**
+ * @brief SPI 하드웨어 CRC 테스트
+ */
+static void Test_SPI_CRC_Functions(SPI_TypeDef* SPIx) {
+    printf("\n=== SPI 하드웨어 CRC 테스트 ===\n");
+    
+    uint8_t tx_data[32];
+    uint8_t rx_data[32];
+    SPI_Status status;
+    
+    for (int i = 0; i < 32; i++) {
+        tx_data[i] = (uint8_t)(i * 7);
+    }
+    
+    // CRC-8 (x^8 + x^2 + x + 1), 8비트 프레임
+    SPI_Config config = {
+        .ClockSpeed = 1000000,
+        .Mode = SPI_MODE_0,
+        .DataSize = 0,
+        .FirstBit = 0,
+        .NSS = 1,
+        .CRCEnable = 1,
+        .CRCPolynomial = SPI_CRC_POLYNOMIAL_DEFAULT
+    };
+    SPI_Init(SPIx, &config);
+    
+    // MOSI-MISO 루프백 시 수신 CRC가 일치해야 함
+    status = SPI_TransferData(SPIx, tx_data, rx_data, sizeof(tx_data));
+    PrintTestResult("CRC 송수신 (루프백)", status);
+    
+    // CRC 값은 전송마다 초기화되어 같은 데이터는 같은 CRC를 생성해야 함
+    uint32_t first_crc = SPIx->TXCRCR;
+    status = SPI_TransferData(SPIx, tx_data, rx_data, sizeof(tx_data));
+    printf("전송별 CRC 초기화: %s (TXCRCR=0x%02lX)\n", SPIx->TXCRCR == first_crc ? "성공" : "실패", (unsigned long)first_crc);
+    
+    status = SPI_WriteData(SPIx, tx_data, sizeof(tx_data));
+    PrintTestResult("CRC 송신 전용", status);
+    
+    dma_done = 0;
+    status = SPI_TransferData_DMA(SPIx, tx_data, rx_data, sizeof(tx_data), DMA_Complete);
+    if (status == SPI_OK) {
+        status = WaitDMA();
+    }
+    PrintTestResult("CRC DMA 송수신", status);
+    
+    // 루프백이 없으면 수신 CRC 불일치 보고
+    status = SPI_ReadData(SPIx, rx_data, sizeof(rx_data));
+    printf("CRC 수신 결과: %s\n", status == SPI_OK ? "일치" : (status == SPI_CRC_ERROR ? "불일치 (SPI_CRC_ERROR)" : "오류"));
+    
+    // CRC 비활성화 설정으로 복원
+    config.CRCEnable = 0;
+    SPI_Init(SPIx, &config);
+}
+
 /**
  * @brief SPI 에러 처리 테스트
  */
@@ -168,6 +737,15 @@ void SPI_Test(void) {
     // 테스트 실행
     Test_SPI_Mode_Functions(SPI1);
     Test_SPI_Data_Functions(SPI1);
+    Test_SPI_Stream_Functions(SPI1);
+    Test_SPI_DMA_Functions(SPI1);
+    Test_SPI_16Bit_Functions(SPI1);
+    Test_SPI_IT_Functions(SPI1);
+    Test_SPI_CRC_Functions(SPI1);
+    Test_SPI_Clock_Functions(SPI1);
+    Test_SPI_Slave_Functions(SPI1);
+    Test_SPI_Direction_Functions(SPI1);
+    Test_SPI_Fill_Functions(SPI1);
     Test_SPI_Error_Functions(SPI1);
     
     // 정리